@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BMS_CALLBACK_INTERFACE_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BMS_CALLBACK_INTERFACE_H
+
+#include <vector>
+
+#include "distributed_bundle_info.h"
+#include "iremote_broker.h"
+#include "remote_ability_info.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * Result callback of the asynchronous queries, every query answers exactly one of its methods once.
+ */
+class IDistributedBmsCallback : public IRemoteBroker {
+public:
+    DECLARE_INTERFACE_DESCRIPTOR(u"ohos.appexecfwk.IDistributedBmsCallback");
+
+    /**
+     * @brief called with the result of an asynchronous remote ability infos query.
+     * @param resultCode Indicates ERR_OK on success, others on failure.
+     * @param remoteAbilityInfos Indicates the remote ability infos in the order of the queried elements.
+     */
+    virtual void OnRemoteAbilityInfosResult(int32_t resultCode,
+        const std::vector<RemoteAbilityInfo> &remoteAbilityInfos) = 0;
+
+    /**
+     * @brief called with the result of an asynchronous remote bundle version code query.
+     * @param resultCode Indicates ERR_OK on success, others on failure.
+     * @param versionCode Indicates the version code.
+     */
+    virtual void OnRemoteBundleVersionCodeResult(int32_t resultCode, uint32_t versionCode) = 0;
+
+    /**
+     * @brief called with the result of an asynchronous distributed bundle info query.
+     * @param result Indicates whether the distributed bundle info is found.
+     * @param distributedBundleInfo Indicates the distributed bundle info.
+     */
+    virtual void OnDistributedBundleInfoResult(bool result, const DistributedBundleInfo &distributedBundleInfo) = 0;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BMS_CALLBACK_INTERFACE_H
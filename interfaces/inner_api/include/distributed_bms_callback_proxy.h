@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BMS_CALLBACK_PROXY_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BMS_CALLBACK_PROXY_H
+
+#include "distributed_bms_callback_interface.h"
+#include "distributed_bundle_ipc_interface_code.h"
+#include "iremote_proxy.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+class DistributedBmsCallbackProxy : public IRemoteProxy<IDistributedBmsCallback> {
+public:
+    explicit DistributedBmsCallbackProxy(const sptr<IRemoteObject> &object);
+    virtual ~DistributedBmsCallbackProxy() override;
+
+    void OnRemoteAbilityInfosResult(int32_t resultCode,
+        const std::vector<RemoteAbilityInfo> &remoteAbilityInfos) override;
+    void OnRemoteBundleVersionCodeResult(int32_t resultCode, uint32_t versionCode) override;
+    void OnDistributedBundleInfoResult(bool result, const DistributedBundleInfo &distributedBundleInfo) override;
+
+private:
+    void SendRequest(DistributedCallbackInterfaceCode code, MessageParcel &data);
+    static inline BrokerDelegator<DistributedBmsCallbackProxy> delegator_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BMS_CALLBACK_PROXY_H
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BMS_CALLBACK_STUB_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BMS_CALLBACK_STUB_H
+
+#include "distributed_bms_callback_interface.h"
+#include "iremote_stub.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+class DistributedBmsCallbackStub : public IRemoteStub<IDistributedBmsCallback> {
+public:
+    DistributedBmsCallbackStub();
+    virtual ~DistributedBmsCallbackStub() override;
+
+    int OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override;
+
+private:
+    int HandleOnRemoteAbilityInfosResult(MessageParcel &data);
+    int HandleOnRemoteBundleVersionCodeResult(MessageParcel &data);
+    int HandleOnDistributedBundleInfoResult(MessageParcel &data);
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BMS_CALLBACK_STUB_H
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BMS_DEADLINE_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BMS_DEADLINE_H
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+
+#include "parcel.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+// the deadline of the query passed before it was answered
+constexpr int32_t ERR_DBMS_DEADLINE_EXCEEDED = -ETIMEDOUT;
+
+/**
+ * Deadline of the query run by the calling thread, set for the lifetime of the object.
+ * Requests sent through the d-bms proxy carry the remaining time, the clocks of two devices are not comparable,
+ * so every hop re-anchors it on its own clock. A nested deadline only ever shortens the outer one.
+ */
+class DistributedBmsDeadline {
+public:
+    static constexpr int64_t NO_DEADLINE = -1;
+
+    /**
+     * @brief set the deadline to timeoutMs from now.
+     * @param timeoutMs Indicates the timeout in milliseconds, NO_DEADLINE or any negative value sets none.
+     */
+    explicit DistributedBmsDeadline(int64_t timeoutMs);
+
+    /**
+     * @brief set the deadline captured by GetDeadline on another thread.
+     * @param deadline Indicates the deadline, time_point::max() sets none.
+     */
+    explicit DistributedBmsDeadline(const std::chrono::steady_clock::time_point &deadline);
+    ~DistributedBmsDeadline();
+    DistributedBmsDeadline(const DistributedBmsDeadline &) = delete;
+    DistributedBmsDeadline &operator=(const DistributedBmsDeadline &) = delete;
+
+    /**
+     * @brief get the deadline of the calling thread, to hand it to the threads working for the same query.
+     * @return Returns the deadline; returns time_point::max() if there is none.
+     */
+    static std::chrono::steady_clock::time_point GetDeadline();
+    static bool IsExpired();
+
+    /**
+     * @brief get the time left until the deadline of the calling thread.
+     * @return Returns the milliseconds left rounded up, 0 once passed; returns NO_DEADLINE if there is none.
+     */
+    static int64_t GetRemainingMs();
+
+    /**
+     * @brief read the remaining time written last into a request, a requester without deadline writes none.
+     * @return Returns the remaining milliseconds; returns NO_DEADLINE if there is none.
+     */
+    static int64_t ReadFromParcel(Parcel &parcel);
+
+private:
+    std::chrono::steady_clock::time_point previous_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BMS_DEADLINE_H
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BMS_INTERFACE_H
 #define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BMS_INTERFACE_H
 
+#include <cerrno>
 #include <string>
 #include <vector>
 
@@ -24,10 +25,17 @@
 #include "distributed_bundle_info.h"
 #include "element_name.h"
 #include "iremote_broker.h"
+#include "remote_ability_binary_info.h"
+#include "remote_ability_conditional_info.h"
+#include "remote_ability_info_options.h"
+#include "remote_ability_info_result.h"
 #include "remote_ability_info.h"
 
 namespace OHOS {
 namespace AppExecFwk {
+// too many asynchronous queries are waiting, the query is rejected instead of queued
+constexpr int32_t ERR_DBMS_SERVICE_BUSY = -EBUSY;
+
 class IDistributedBms : public IRemoteBroker {
 public:
     DECLARE_INTERFACE_DESCRIPTOR(u"ohos.appexecfwk.IDistributedbms");
@@ -134,6 +142,114 @@ public:
         return ERR_APPEXECFWK_SERVICE_INTERNAL_ERROR;
     }
 
+    /**
+     * @brief get remote ability infos with the icons as raw image bytes.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param remoteAbilityInfos Indicates the remote ability infos with binary icons.
+     * @return Returns result code when get remote ability infos.
+     */
+    virtual int32_t GetRemoteAbilityInfosWithBinaryIcon(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos)
+    {
+        return ERR_APPEXECFWK_SERVICE_INTERNAL_ERROR;
+    }
+
+    /**
+     * @brief get ability infos with the icons as raw image bytes.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param remoteAbilityInfos Indicates the remote ability infos with binary icons.
+     * @param info Indicates the acl info.
+     * @return Returns result code when get ability infos.
+     */
+    virtual int32_t GetAbilityInfosWithBinaryIcon(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos,
+        DistributedBmsAclInfo *info = nullptr)
+    {
+        return ERR_APPEXECFWK_SERVICE_INTERNAL_ERROR;
+    }
+
+    /**
+     * @brief get remote ability infos, the icons matching the given hashes are not sent again.
+     * @param elementNames Indicates the elementNames.
+     * @param iconHashes Indicates the hashes of the icons held by the caller, empty or one per elementName.
+     * @param localeInfo Indicates the localeInfo.
+     * @param remoteAbilityInfos Indicates the remote ability infos with the hashes of the icons.
+     * @return Returns result code when get remote ability infos.
+     */
+    virtual int32_t GetRemoteAbilityInfosIfModified(const std::vector<ElementName> &elementNames,
+        const std::vector<std::string> &iconHashes, const std::string &localeInfo,
+        std::vector<RemoteAbilityConditionalInfo> &remoteAbilityInfos)
+    {
+        return ERR_APPEXECFWK_SERVICE_INTERNAL_ERROR;
+    }
+
+    /**
+     * @brief get ability infos, the icons matching the given hashes are not sent again.
+     * @param elementNames Indicates the elementNames.
+     * @param iconHashes Indicates the hashes of the icons held by the caller, empty or one per elementName.
+     * @param localeInfo Indicates the localeInfo.
+     * @param remoteAbilityInfos Indicates the remote ability infos with the hashes of the icons.
+     * @param info Indicates the acl info.
+     * @return Returns result code when get ability infos.
+     */
+    virtual int32_t GetAbilityInfosIfModified(const std::vector<ElementName> &elementNames,
+        const std::vector<std::string> &iconHashes, const std::string &localeInfo,
+        std::vector<RemoteAbilityConditionalInfo> &remoteAbilityInfos, DistributedBmsAclInfo *info = nullptr)
+    {
+        return ERR_APPEXECFWK_SERVICE_INTERNAL_ERROR;
+    }
+
+    /**
+     * @brief get remote ability infos, a failed element does not fail the batch.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param options Indicates the fields to return and the icon size.
+     * @param remoteAbilityInfos Indicates the remote ability infos with the result code of each element.
+     * @return Returns ERR_OK if every element has its result; returns the error of the whole batch otherwise.
+     */
+    virtual int32_t GetRemoteAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+    {
+        return ERR_APPEXECFWK_SERVICE_INTERNAL_ERROR;
+    }
+
+    /**
+     * @brief get ability infos, a failed element does not fail the batch.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param options Indicates the fields to return and the icon size.
+     * @param remoteAbilityInfos Indicates the remote ability infos with the result code of each element.
+     * @param info Indicates the acl info.
+     * @return Returns ERR_OK if every element has its result; returns the error of the whole batch otherwise.
+     */
+    virtual int32_t GetAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos,
+        DistributedBmsAclInfo *info = nullptr)
+    {
+        return ERR_APPEXECFWK_SERVICE_INTERNAL_ERROR;
+    }
+
+    /**
+     * @brief get remote ability infos chunk by chunk, a failed element does not fail the batch.
+     * @param elementNames Indicates the elementNames, only read when a query is started.
+     * @param localeInfo Indicates the localeInfo, only read when a query is started.
+     * @param options Indicates the fields to return and the icon size, only read when a query is started.
+     * @param continuationToken Indicates 0 to start a query or the token of the next chunk, set to the token
+     * of the following chunk or to 0 when the last chunk is returned.
+     * @param remoteAbilityInfos Indicates the remote ability infos of the chunk with the result code of each element.
+     * @return Returns ERR_OK if every element of the chunk has its result; returns the error of the chunk otherwise.
+     */
+    virtual int32_t GetRemoteAbilityInfosChunked(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const RemoteAbilityInfoOptions &options, uint64_t &continuationToken,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+    {
+        return ERR_APPEXECFWK_SERVICE_INTERNAL_ERROR;
+    }
+
     virtual bool GetDistributedBundleInfo(const std::string &networkId, const std::string &bundleName,
         DistributedBundleInfo &distributedBundleInfo)
     {
@@ -178,6 +294,48 @@ public:
     {
         return ERR_APPEXECFWK_SERVICE_INTERNAL_ERROR;
     }
+
+    /**
+     * @brief get remote ability infos without waiting for them, the result is sent to the callback.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param callback Indicates the IDistributedBmsCallback receiving the remote ability infos.
+     * @return Returns ERR_OK if the query is sent, then the callback is called exactly once;
+     * returns the failure otherwise.
+     */
+    virtual int32_t GetRemoteAbilityInfosAsync(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const sptr<IRemoteObject> &callback)
+    {
+        return ERR_APPEXECFWK_SERVICE_INTERNAL_ERROR;
+    }
+
+    /**
+     * @brief get remote bundle version code without waiting for it, the result is sent to the callback.
+     * @param deviceId Indicates the deviceId of remote device.
+     * @param bundleName Indicates the bundleName.
+     * @param callback Indicates the IDistributedBmsCallback receiving the version code.
+     * @return Returns ERR_OK if the query is sent, then the callback is called exactly once;
+     * returns the failure otherwise.
+     */
+    virtual int32_t GetRemoteBundleVersionCodeAsync(const std::string &deviceId, const std::string &bundleName,
+        const sptr<IRemoteObject> &callback)
+    {
+        return ERR_APPEXECFWK_SERVICE_INTERNAL_ERROR;
+    }
+
+    /**
+     * @brief get distributed bundle info without waiting for it, the result is sent to the callback.
+     * @param networkId Indicates the networkId of remote device.
+     * @param bundleName Indicates the bundleName.
+     * @param callback Indicates the IDistributedBmsCallback receiving the distributed bundle info.
+     * @return Returns ERR_OK if the query is sent, then the callback is called exactly once;
+     * returns the failure otherwise.
+     */
+    virtual int32_t GetDistributedBundleInfoAsync(const std::string &networkId, const std::string &bundleName,
+        const sptr<IRemoteObject> &callback)
+    {
+        return ERR_APPEXECFWK_SERVICE_INTERNAL_ERROR;
+    }
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -106,7 +106,95 @@ public:
      */
     int32_t GetAbilityInfos(const std::vector<ElementName> &elementNames, const std::string &localeInfo,
         std::vector<RemoteAbilityInfo> &remoteAbilityInfos, DistributedBmsAclInfo *info = nullptr) override;
-    
+
+    /**
+     * @brief get remote ability infos with the icons as raw image bytes.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param remoteAbilityInfos Indicates the remote ability infos with binary icons.
+     * @return Returns result code when get remote ability infos.
+     */
+    int32_t GetRemoteAbilityInfosWithBinaryIcon(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos) override;
+
+    /**
+     * @brief get ability infos with the icons as raw image bytes.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param remoteAbilityInfos Indicates the remote ability infos with binary icons.
+     * @param info Indicates the acl info.
+     * @return Returns result code when get ability infos.
+     */
+    int32_t GetAbilityInfosWithBinaryIcon(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos,
+        DistributedBmsAclInfo *info = nullptr) override;
+
+    /**
+     * @brief get remote ability infos, the icons matching the given hashes are not sent again.
+     * @param elementNames Indicates the elementNames.
+     * @param iconHashes Indicates the hashes of the icons held by the caller, empty or one per elementName.
+     * @param localeInfo Indicates the localeInfo.
+     * @param remoteAbilityInfos Indicates the remote ability infos with the hashes of the icons.
+     * @return Returns result code when get remote ability infos.
+     */
+    int32_t GetRemoteAbilityInfosIfModified(const std::vector<ElementName> &elementNames,
+        const std::vector<std::string> &iconHashes, const std::string &localeInfo,
+        std::vector<RemoteAbilityConditionalInfo> &remoteAbilityInfos) override;
+
+    /**
+     * @brief get ability infos, the icons matching the given hashes are not sent again.
+     * @param elementNames Indicates the elementNames.
+     * @param iconHashes Indicates the hashes of the icons held by the caller, empty or one per elementName.
+     * @param localeInfo Indicates the localeInfo.
+     * @param remoteAbilityInfos Indicates the remote ability infos with the hashes of the icons.
+     * @param info Indicates the acl info.
+     * @return Returns result code when get ability infos.
+     */
+    int32_t GetAbilityInfosIfModified(const std::vector<ElementName> &elementNames,
+        const std::vector<std::string> &iconHashes, const std::string &localeInfo,
+        std::vector<RemoteAbilityConditionalInfo> &remoteAbilityInfos,
+        DistributedBmsAclInfo *info = nullptr) override;
+
+    /**
+     * @brief get remote ability infos, a failed element does not fail the batch.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param options Indicates the fields to return and the icon size.
+     * @param remoteAbilityInfos Indicates the remote ability infos with the result code of each element.
+     * @return Returns ERR_OK if every element has its result; returns the error of the whole batch otherwise.
+     */
+    int32_t GetRemoteAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos) override;
+
+    /**
+     * @brief get ability infos, a failed element does not fail the batch.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param options Indicates the fields to return and the icon size.
+     * @param remoteAbilityInfos Indicates the remote ability infos with the result code of each element.
+     * @param info Indicates the acl info.
+     * @return Returns ERR_OK if every element has its result; returns the error of the whole batch otherwise.
+     */
+    int32_t GetAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos,
+        DistributedBmsAclInfo *info = nullptr) override;
+
+    /**
+     * @brief get remote ability infos chunk by chunk, a failed element does not fail the batch.
+     * @param elementNames Indicates the elementNames, only read when a query is started.
+     * @param localeInfo Indicates the localeInfo, only read when a query is started.
+     * @param options Indicates the fields to return and the icon size, only read when a query is started.
+     * @param continuationToken Indicates 0 to start a query or the token of the next chunk, set to the token
+     * of the following chunk or to 0 when the last chunk is returned.
+     * @param remoteAbilityInfos Indicates the remote ability infos of the chunk with the result code of each element.
+     * @return Returns ERR_OK if every element of the chunk has its result; returns the error of the chunk otherwise.
+     */
+    int32_t GetRemoteAbilityInfosChunked(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const RemoteAbilityInfoOptions &options, uint64_t &continuationToken,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos) override;
+
     bool GetDistributedBundleInfo(const std::string &networkId, const std::string &bundleName,
         DistributedBundleInfo &distributedBundleInfo) override;
 
@@ -139,14 +227,50 @@ public:
      */
     int32_t GetBundleVersionCode(const std::string &bundleName, uint32_t &versionCode,
         DistributedBmsAclInfo &info) override;
+
+    /**
+     * @brief get remote ability infos without waiting for them, the result is sent to the callback.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param callback Indicates the IDistributedBmsCallback receiving the remote ability infos.
+     * @return Returns ERR_OK if the query is sent, then the callback is called exactly once;
+     * returns the failure otherwise.
+     */
+    int32_t GetRemoteAbilityInfosAsync(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const sptr<IRemoteObject> &callback) override;
+
+    /**
+     * @brief get remote bundle version code without waiting for it, the result is sent to the callback.
+     * @param deviceId Indicates the deviceId of remote device.
+     * @param bundleName Indicates the bundleName.
+     * @param callback Indicates the IDistributedBmsCallback receiving the version code.
+     * @return Returns ERR_OK if the query is sent, then the callback is called exactly once;
+     * returns the failure otherwise.
+     */
+    int32_t GetRemoteBundleVersionCodeAsync(const std::string &deviceId, const std::string &bundleName,
+        const sptr<IRemoteObject> &callback) override;
+
+    /**
+     * @brief get distributed bundle info without waiting for it, the result is sent to the callback.
+     * @param networkId Indicates the networkId of remote device.
+     * @param bundleName Indicates the bundleName.
+     * @param callback Indicates the IDistributedBmsCallback receiving the distributed bundle info.
+     * @return Returns ERR_OK if the query is sent, then the callback is called exactly once;
+     * returns the failure otherwise.
+     */
+    int32_t GetDistributedBundleInfoAsync(const std::string &networkId, const std::string &bundleName,
+        const sptr<IRemoteObject> &callback) override;
 private:
     int32_t SendRequest(DistributedInterfaceCode code, MessageParcel &data, MessageParcel &reply);
+    int32_t SendAsyncRequest(DistributedInterfaceCode code, MessageParcel &data);
     template<typename T>
     bool WriteParcelableVector(const std::vector<T> &parcelableVector, Parcel &data);
     template <typename T>
     int32_t GetParcelableInfo(DistributedInterfaceCode code, MessageParcel &data, T &parcelableInfo);
     template <typename T>
     int32_t GetParcelableInfos(DistributedInterfaceCode code, MessageParcel &data, std::vector<T> &parcelableInfos);
+    int32_t GetBinaryInfos(DistributedInterfaceCode code, MessageParcel &data,
+        std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos);
     int32_t CheckElementName(const ElementName &elementName);
     static inline BrokerDelegator<DistributedBmsProxy> delegator_;
 };
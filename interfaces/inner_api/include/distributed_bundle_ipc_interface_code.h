@@ -32,6 +32,22 @@ enum class DistributedInterfaceCode : uint32_t {
     GET_DISTRIBUTED_BUNDLE_NAME,
     GET_REMOTE_BUNDLE_VERSION_CODE,
     GET_BUNDLE_VERSION_CODE,
+    GET_REMOTE_ABILITY_INFOS_WITH_BINARY_ICON,
+    GET_ABILITY_INFOS_WITH_BINARY_ICON,
+    GET_REMOTE_ABILITY_INFOS_IF_MODIFIED,
+    GET_ABILITY_INFOS_IF_MODIFIED,
+    GET_REMOTE_ABILITY_INFOS_PARTIAL,
+    GET_ABILITY_INFOS_PARTIAL,
+    GET_REMOTE_ABILITY_INFOS_CHUNKED,
+    GET_REMOTE_ABILITY_INFOS_ASYNC,
+    GET_REMOTE_BUNDLE_VERSION_CODE_ASYNC,
+    GET_DISTRIBUTED_BUNDLE_INFO_ASYNC,
+};
+
+enum class DistributedCallbackInterfaceCode : uint32_t {
+    ON_REMOTE_ABILITY_INFOS_RESULT = 0,
+    ON_REMOTE_BUNDLE_VERSION_CODE_RESULT,
+    ON_DISTRIBUTED_BUNDLE_INFO_RESULT,
 };
 } // namespace AppExecFwk
 } // namespace OHOS
@@ -16,8 +16,14 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BUNDLE_MGR_CLIENT_H
 #define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BUNDLE_MGR_CLIENT_H
 
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+
 #include "iremote_object.h"
 #include "device_manager_callback.h"
+#include "distributed_bms_callback_stub.h"
 #include "distributed_bms_interface.h"
 #include "singleton.h"
 
@@ -25,6 +31,11 @@ namespace OHOS {
 namespace AppExecFwk {
 class DistributedBundleMgrClient : public DelayedSingleton<DistributedBundleMgrClient> {
 public:
+    using RemoteAbilityInfoCallback = std::function<void(int32_t, const RemoteAbilityInfo &)>;
+    using RemoteAbilityInfosCallback = std::function<void(int32_t, const std::vector<RemoteAbilityInfo> &)>;
+    using RemoteBundleVersionCodeCallback = std::function<void(int32_t, uint32_t)>;
+    using DistributedBundleInfoCallback = std::function<void(bool, const DistributedBundleInfo &)>;
+
     /**
      * @brief get remote ability info
      * @param elementName Indicates the elementName.
@@ -62,6 +73,30 @@ public:
     int32_t GetRemoteAbilityInfos(const std::vector<ElementName> &elementNames, const std::string &localeInfo,
         std::vector<RemoteAbilityInfo> &remoteAbilityInfos);
 
+    /**
+     * @brief get remote ability infos, a failed element does not fail the batch.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param options Indicates the fields to return and the icon size.
+     * @param remoteAbilityInfos Indicates the remote ability infos with the result code of each element.
+     * @return Returns ERR_OK if every element has its result; returns the error of the whole batch otherwise.
+     */
+    int32_t GetRemoteAbilityInfosPartial(const std::vector<ElementName> &elementNames, const std::string &localeInfo,
+        const RemoteAbilityInfoOptions &options, std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos);
+
+    /**
+     * @brief get remote ability infos of any number of elements, the service answers them chunk by chunk.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param options Indicates the fields to return and the icon size.
+     * @param onChunk Indicates the callback receiving the results of every chunk in input order,
+     * returns false to stop the query.
+     * @return Returns ERR_OK if every chunk has its results; returns the error of the failed chunk otherwise.
+     */
+    int32_t GetRemoteAbilityInfosChunked(const std::vector<ElementName> &elementNames, const std::string &localeInfo,
+        const RemoteAbilityInfoOptions &options,
+        const std::function<bool(std::vector<RemoteAbilityInfoResult> &)> &onChunk);
+
     bool GetDistributedBundleInfo(const std::string &networkId, const std::string &bundleName,
         DistributedBundleInfo &distributedBundleInfo);
 
@@ -84,8 +119,85 @@ public:
     int32_t GetRemoteBundleVersionCode(const std::string &deviceId, const std::string &bundleName,
         uint32_t &versionCode);
 
+    /**
+     * @brief get remote ability info without blocking the calling thread.
+     * @param elementName Indicates the elementName.
+     * @param localeInfo Indicates the localeInfo.
+     * @param callback Indicates the callback receiving the result code and the remote ability info on an ipc thread.
+     * @return Returns ERR_OK if the query is sent, then the callback is called exactly once;
+     * returns the failure otherwise.
+     */
+    int32_t GetRemoteAbilityInfoAsync(const ElementName &elementName, const std::string &localeInfo,
+        const RemoteAbilityInfoCallback &callback);
+
+    /**
+     * @brief get remote ability infos without blocking the calling thread.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param callback Indicates the callback receiving the result code and the remote ability infos on an ipc thread.
+     * @return Returns ERR_OK if the query is sent, then the callback is called exactly once;
+     * returns the failure otherwise.
+     */
+    int32_t GetRemoteAbilityInfosAsync(const std::vector<ElementName> &elementNames, const std::string &localeInfo,
+        const RemoteAbilityInfosCallback &callback);
+
+    /**
+     * @brief get remote bundle version code without blocking the calling thread.
+     * @param deviceId Indicates the deviceId of remote device.
+     * @param bundleName Indicates the bundleName.
+     * @param callback Indicates the callback receiving the result code and the version code on an ipc thread.
+     * @return Returns ERR_OK if the query is sent, then the callback is called exactly once;
+     * returns the failure otherwise.
+     */
+    int32_t GetRemoteBundleVersionCodeAsync(const std::string &deviceId, const std::string &bundleName,
+        const RemoteBundleVersionCodeCallback &callback);
+
+    /**
+     * @brief get distributed bundle info without blocking the calling thread.
+     * @param networkId Indicates the networkId of remote device.
+     * @param bundleName Indicates the bundleName.
+     * @param callback Indicates the callback receiving whether the info is found and the info on an ipc thread.
+     * @return Returns ERR_OK if the query is sent, then the callback is called exactly once;
+     * returns the failure otherwise.
+     */
+    int32_t GetDistributedBundleInfoAsync(const std::string &networkId, const std::string &bundleName,
+        const DistributedBundleInfoCallback &callback);
+
     void ResetDistributedBundleMgrProxy();
 private:
+    class AsyncQueryCallback : public DistributedBmsCallbackStub {
+    public:
+        AsyncQueryCallback(DistributedBundleMgrClient *client, uint64_t id) : client_(client), id_(id) {}
+        void OnRemoteAbilityInfosResult(int32_t resultCode,
+            const std::vector<RemoteAbilityInfo> &remoteAbilityInfos) override;
+        void OnRemoteBundleVersionCodeResult(int32_t resultCode, uint32_t versionCode) override;
+        void OnDistributedBundleInfoResult(bool result, const DistributedBundleInfo &distributedBundleInfo) override;
+
+        /**
+         * @brief answer the query with resultCode, unless its result has already come.
+         */
+        void Fail(int32_t resultCode);
+
+        /**
+         * @brief claim the single answer of the query.
+         * @return Returns true for the first caller only.
+         */
+        bool Finish();
+        uint64_t GetId() const
+        {
+            return id_;
+        }
+
+        RemoteAbilityInfosCallback onAbilityInfos;
+        RemoteBundleVersionCodeCallback onVersionCode;
+        DistributedBundleInfoCallback onBundleInfo;
+
+    private:
+        DistributedBundleMgrClient *client_ = nullptr;
+        uint64_t id_ = 0;
+        std::atomic<bool> finished_ {false};
+    };
+
     sptr<IDistributedBms> dProxy_;
     std::mutex dProxyMutex_;
     std::shared_ptr<DistributedHardware::DmInitCallback> initCallback_;
@@ -94,7 +206,16 @@ private:
     sptr<IRemoteObject::DeathRecipient> recipient_;
     std::mutex getProxyMutex_;
 
+    // queries sent but not answered yet, failed at once if the service dies
+    std::mutex pendingMutex_;
+    uint64_t nextCallbackId_ = 0;
+    std::map<uint64_t, sptr<AsyncQueryCallback>> pendingCallbacks_;
+
     sptr<IDistributedBms> GetDistributedBundleMgrProxy();
+    sptr<AsyncQueryCallback> CreateAsyncQueryCallback();
+    int32_t SendAsyncQuery(const sptr<AsyncQueryCallback> &queryCallback,
+        const std::function<int32_t(const sptr<IDistributedBms> &, const sptr<IRemoteObject> &)> &send);
+    void RemovePendingCallback(uint64_t id);
     bool LoadDistributedBundleMgrService();
     bool InitDeviceManager();
 
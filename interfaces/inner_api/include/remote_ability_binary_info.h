@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_REMOTE_ABILITY_BINARY_INFO_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_REMOTE_ABILITY_BINARY_INFO_H
+
+#include <string>
+#include <vector>
+
+#include "element_name.h"
+#include "message_parcel.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @brief remote ability info carrying the icon as raw image bytes instead of a base64 data uri.
+ */
+struct RemoteAbilityBinaryInfo {
+    ElementName elementName;
+    std::string label;
+    std::string iconType;
+    std::vector<uint8_t> icon;
+
+    /**
+     * @brief read infos written by MarshallingInfos, the icons are cut from the icon blob.
+     * @param parcel Indicates the parcel to read from.
+     * @param infos Indicates the infos read.
+     * @return Returns true if every info and the icon blob are read; returns false otherwise.
+     */
+    static bool ReadInfosFromParcel(MessageParcel &parcel, std::vector<RemoteAbilityBinaryInfo> &infos);
+
+    /**
+     * @brief write the infos, followed by every icon in one blob so a reply holds a single raw data block.
+     * @param infos Indicates the infos to write.
+     * @param parcel Indicates the parcel to write to.
+     * @param allowRawData Indicates whether a large blob may go through ashmem, which does not cross devices.
+     * @return Returns true if the infos and the icon blob are written; returns false otherwise.
+     */
+    static bool MarshallingInfos(const std::vector<RemoteAbilityBinaryInfo> &infos, MessageParcel &parcel,
+        bool allowRawData);
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_REMOTE_ABILITY_BINARY_INFO_H
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_REMOTE_ABILITY_CONDITIONAL_INFO_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_REMOTE_ABILITY_CONDITIONAL_INFO_H
+
+#include <string>
+
+#include "parcel.h"
+#include "remote_ability_info.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @brief remote ability info of a conditional query, the icon is left empty when it matches the hash
+ * the requester already holds.
+ */
+struct RemoteAbilityConditionalInfo : public Parcelable {
+    RemoteAbilityInfo remoteAbilityInfo;
+    // content hash of the icon held by the remote side, empty if the ability has no icon
+    std::string iconHash;
+    bool iconModified = true;
+
+    bool ReadFromParcel(Parcel &parcel);
+    virtual bool Marshalling(Parcel &parcel) const override;
+    static RemoteAbilityConditionalInfo *Unmarshalling(Parcel &parcel);
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_REMOTE_ABILITY_CONDITIONAL_INFO_H
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_REMOTE_ABILITY_INFO_OPTIONS_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_REMOTE_ABILITY_INFO_OPTIONS_H
+
+#include <cstdint>
+
+#include "parcel.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+enum RemoteAbilityInfoField : uint32_t {
+    REMOTE_ABILITY_INFO_FIELD_LABEL = 0x00000001,
+    REMOTE_ABILITY_INFO_FIELD_ICON = 0x00000002,
+    REMOTE_ABILITY_INFO_FIELD_ALL = REMOTE_ABILITY_INFO_FIELD_LABEL | REMOTE_ABILITY_INFO_FIELD_ICON,
+};
+
+/**
+ * @brief selects what a remote ability info query returns. The elementName is always returned, the label and
+ * the icon only when their field is set. maxIconEdge limits the longer edge of the icon in pixels, 0 for the
+ * default size.
+ */
+struct RemoteAbilityInfoOptions : public Parcelable {
+    uint32_t fields = REMOTE_ABILITY_INFO_FIELD_ALL;
+    int32_t maxIconEdge = 0;
+
+    bool HasLabel() const
+    {
+        return (fields & REMOTE_ABILITY_INFO_FIELD_LABEL) != 0;
+    }
+
+    bool HasIcon() const
+    {
+        return (fields & REMOTE_ABILITY_INFO_FIELD_ICON) != 0;
+    }
+
+    /**
+     * @brief check the options, at least one field is selected and the edge is not negative.
+     */
+    bool IsValid() const;
+    bool ReadFromParcel(Parcel &parcel);
+    virtual bool Marshalling(Parcel &parcel) const override;
+    static RemoteAbilityInfoOptions *Unmarshalling(Parcel &parcel);
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_REMOTE_ABILITY_INFO_OPTIONS_H
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_REMOTE_ABILITY_INFO_RESULT_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_REMOTE_ABILITY_INFO_RESULT_H
+
+#include <string>
+
+#include "parcel.h"
+#include "remote_ability_info.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @brief remote ability info of one element of a partial batch query, resultCode tells whether the element
+ * was resolved. The elementName is always set, the label and icon only when resultCode is ERR_OK.
+ */
+struct RemoteAbilityInfoResult : public Parcelable {
+    RemoteAbilityInfo remoteAbilityInfo;
+    int32_t resultCode = 0;
+
+    bool ReadFromParcel(Parcel &parcel);
+    virtual bool Marshalling(Parcel &parcel) const override;
+    static RemoteAbilityInfoResult *Unmarshalling(Parcel &parcel);
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_REMOTE_ABILITY_INFO_RESULT_H
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed_bms_callback_proxy.h"
+
+#include "app_log_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+DistributedBmsCallbackProxy::DistributedBmsCallbackProxy(const sptr<IRemoteObject> &object)
+    : IRemoteProxy<IDistributedBmsCallback>(object)
+{
+    APP_LOGD("DistributedBmsCallbackProxy instance is created");
+}
+
+DistributedBmsCallbackProxy::~DistributedBmsCallbackProxy()
+{
+    APP_LOGD("DistributedBmsCallbackProxy instance is destroyed");
+}
+
+void DistributedBmsCallbackProxy::OnRemoteAbilityInfosResult(int32_t resultCode,
+    const std::vector<RemoteAbilityInfo> &remoteAbilityInfos)
+{
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        APP_LOGE("write InterfaceToken failed");
+        return;
+    }
+    if (!data.WriteInt32(resultCode) || !data.WriteInt32(static_cast<int32_t>(remoteAbilityInfos.size()))) {
+        APP_LOGE("write resultCode failed");
+        return;
+    }
+    for (const auto &remoteAbilityInfo : remoteAbilityInfos) {
+        if (!data.WriteParcelable(&remoteAbilityInfo)) {
+            APP_LOGE("write remoteAbilityInfo failed");
+            return;
+        }
+    }
+    SendRequest(DistributedCallbackInterfaceCode::ON_REMOTE_ABILITY_INFOS_RESULT, data);
+}
+
+void DistributedBmsCallbackProxy::OnRemoteBundleVersionCodeResult(int32_t resultCode, uint32_t versionCode)
+{
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        APP_LOGE("write InterfaceToken failed");
+        return;
+    }
+    if (!data.WriteInt32(resultCode) || !data.WriteUint32(versionCode)) {
+        APP_LOGE("write versionCode failed");
+        return;
+    }
+    SendRequest(DistributedCallbackInterfaceCode::ON_REMOTE_BUNDLE_VERSION_CODE_RESULT, data);
+}
+
+void DistributedBmsCallbackProxy::OnDistributedBundleInfoResult(bool result,
+    const DistributedBundleInfo &distributedBundleInfo)
+{
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        APP_LOGE("write InterfaceToken failed");
+        return;
+    }
+    if (!data.WriteBool(result) || !data.WriteParcelable(&distributedBundleInfo)) {
+        APP_LOGE("write distributedBundleInfo failed");
+        return;
+    }
+    SendRequest(DistributedCallbackInterfaceCode::ON_DISTRIBUTED_BUNDLE_INFO_RESULT, data);
+}
+
+void DistributedBmsCallbackProxy::SendRequest(DistributedCallbackInterfaceCode code, MessageParcel &data)
+{
+    sptr<IRemoteObject> remote = Remote();
+    if (remote == nullptr) {
+        APP_LOGE("fail to send %{public}d cmd to client due to remote object is null", code);
+        return;
+    }
+    // the service never waits on a client
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+    int32_t result = remote->SendRequest(static_cast<uint32_t>(code), data, reply, option);
+    if (result != OHOS::NO_ERROR) {
+        APP_LOGE("fail to send %{public}d cmd to client due to transact error:%{public}d", code, result);
+    }
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed_bms_callback_stub.h"
+
+#include "app_log_wrapper.h"
+#include "appexecfwk_errors.h"
+#include "distributed_bundle_ipc_interface_code.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+    constexpr int32_t MAX_REMOTE_ABILITY_INFOS_SIZE = 512;
+}
+
+DistributedBmsCallbackStub::DistributedBmsCallbackStub()
+{
+    APP_LOGD("DistributedBmsCallbackStub instance is created");
+}
+
+DistributedBmsCallbackStub::~DistributedBmsCallbackStub()
+{
+    APP_LOGD("DistributedBmsCallbackStub instance is destroyed");
+}
+
+int DistributedBmsCallbackStub::OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply,
+    MessageOption &option)
+{
+    if (data.ReadInterfaceToken() != DistributedBmsCallbackStub::GetDescriptor()) {
+        APP_LOGE("verify interface token failed");
+        return ERR_INVALID_STATE;
+    }
+    switch (code) {
+        case static_cast<uint32_t>(DistributedCallbackInterfaceCode::ON_REMOTE_ABILITY_INFOS_RESULT):
+            return HandleOnRemoteAbilityInfosResult(data);
+        case static_cast<uint32_t>(DistributedCallbackInterfaceCode::ON_REMOTE_BUNDLE_VERSION_CODE_RESULT):
+            return HandleOnRemoteBundleVersionCodeResult(data);
+        case static_cast<uint32_t>(DistributedCallbackInterfaceCode::ON_DISTRIBUTED_BUNDLE_INFO_RESULT):
+            return HandleOnDistributedBundleInfoResult(data);
+        default:
+            APP_LOGW("DistributedBmsCallbackStub receives unknown code, code = %{public}d", code);
+            return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
+    }
+}
+
+int DistributedBmsCallbackStub::HandleOnRemoteAbilityInfosResult(MessageParcel &data)
+{
+    int32_t resultCode = data.ReadInt32();
+    int32_t infoSize = data.ReadInt32();
+    std::vector<RemoteAbilityInfo> remoteAbilityInfos;
+    if (infoSize < 0 || infoSize > MAX_REMOTE_ABILITY_INFOS_SIZE) {
+        APP_LOGE("invalid size of remoteAbilityInfos:%{public}d", infoSize);
+        OnRemoteAbilityInfosResult(ERR_APPEXECFWK_PARCEL_ERROR, remoteAbilityInfos);
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    for (int32_t i = 0; i < infoSize; ++i) {
+        std::unique_ptr<RemoteAbilityInfo> info(data.ReadParcelable<RemoteAbilityInfo>());
+        if (!info) {
+            APP_LOGE("read remoteAbilityInfo failed");
+            remoteAbilityInfos.clear();
+            OnRemoteAbilityInfosResult(ERR_APPEXECFWK_PARCEL_ERROR, remoteAbilityInfos);
+            return ERR_APPEXECFWK_PARCEL_ERROR;
+        }
+        remoteAbilityInfos.emplace_back(*info);
+    }
+    OnRemoteAbilityInfosResult(resultCode, remoteAbilityInfos);
+    return NO_ERROR;
+}
+
+int DistributedBmsCallbackStub::HandleOnRemoteBundleVersionCodeResult(MessageParcel &data)
+{
+    int32_t resultCode = data.ReadInt32();
+    uint32_t versionCode = data.ReadUint32();
+    OnRemoteBundleVersionCodeResult(resultCode, versionCode);
+    return NO_ERROR;
+}
+
+int DistributedBmsCallbackStub::HandleOnDistributedBundleInfoResult(MessageParcel &data)
+{
+    bool result = data.ReadBool();
+    std::unique_ptr<DistributedBundleInfo> info(data.ReadParcelable<DistributedBundleInfo>());
+    if (!info) {
+        APP_LOGE("read distributedBundleInfo failed");
+        OnDistributedBundleInfoResult(false, DistributedBundleInfo());
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    OnDistributedBundleInfoResult(result, *info);
+    return NO_ERROR;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
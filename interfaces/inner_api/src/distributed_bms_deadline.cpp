@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed_bms_deadline.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+    // a longer timeout is taken as this, so that adding it to the clock cannot overflow
+    constexpr int64_t MAX_TIMEOUT_MS = 24 * 60 * 60 * 1000;
+
+    thread_local std::chrono::steady_clock::time_point g_deadline = std::chrono::steady_clock::time_point::max();
+
+    std::chrono::steady_clock::time_point ToDeadline(int64_t timeoutMs)
+    {
+        if (timeoutMs < 0) {
+            return std::chrono::steady_clock::time_point::max();
+        }
+        return std::chrono::steady_clock::now() + std::chrono::milliseconds(std::min(timeoutMs, MAX_TIMEOUT_MS));
+    }
+}
+
+DistributedBmsDeadline::DistributedBmsDeadline(int64_t timeoutMs) : DistributedBmsDeadline(ToDeadline(timeoutMs))
+{
+}
+
+DistributedBmsDeadline::DistributedBmsDeadline(const std::chrono::steady_clock::time_point &deadline)
+    : previous_(g_deadline)
+{
+    g_deadline = std::min(g_deadline, deadline);
+}
+
+DistributedBmsDeadline::~DistributedBmsDeadline()
+{
+    g_deadline = previous_;
+}
+
+std::chrono::steady_clock::time_point DistributedBmsDeadline::GetDeadline()
+{
+    return g_deadline;
+}
+
+bool DistributedBmsDeadline::IsExpired()
+{
+    return g_deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= g_deadline;
+}
+
+int64_t DistributedBmsDeadline::GetRemainingMs()
+{
+    if (g_deadline == std::chrono::steady_clock::time_point::max()) {
+        return NO_DEADLINE;
+    }
+    auto remaining = g_deadline - std::chrono::steady_clock::now();
+    if (remaining <= std::chrono::steady_clock::duration::zero()) {
+        return 0;
+    }
+    return std::chrono::ceil<std::chrono::milliseconds>(remaining).count();
+}
+
+int64_t DistributedBmsDeadline::ReadFromParcel(Parcel &parcel)
+{
+    if (parcel.GetReadableBytes() < sizeof(int64_t)) {
+        return NO_DEADLINE;
+    }
+    int64_t remainingMs = parcel.ReadInt64();
+    return remainingMs < 0 ? NO_DEADLINE : remainingMs;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
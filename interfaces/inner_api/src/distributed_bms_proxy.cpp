@@ -17,10 +17,15 @@
 
 #include "app_log_wrapper.h"
 #include "appexecfwk_errors.h"
+#include "distributed_bms_deadline.h"
 #include "parcel_macro.h"
 
 namespace OHOS {
 namespace AppExecFwk {
+namespace {
+    constexpr int64_t MILLISECONDS_PER_SECOND = 1000;
+}
+
 DistributedBmsProxy::DistributedBmsProxy(const sptr<IRemoteObject> &object) : IRemoteProxy<IDistributedBms>(object)
 {
     APP_LOGI("DistributedBmsProxy instance is created");
@@ -209,6 +214,245 @@ int32_t DistributedBmsProxy::GetAbilityInfos(const std::vector<ElementName> &ele
     return result;
 }
 
+int32_t DistributedBmsProxy::GetRemoteAbilityInfosWithBinaryIcon(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos)
+{
+    APP_LOGD("DistributedBmsProxy GetRemoteAbilityInfosWithBinaryIcon");
+    for (const auto &elementName : elementNames) {
+        int32_t checkRet = CheckElementName(elementName);
+        if (checkRet != ERR_OK) {
+            APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosWithBinaryIcon check elementName failed");
+            return checkRet;
+        }
+    }
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        APP_LOGE("fail to GetRemoteAbilityInfosWithBinaryIcon due to write InterfaceToken fail");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!WriteParcelableVector(elementNames, data)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosWithBinaryIcon write elementName error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteString(localeInfo)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosWithBinaryIcon write localeInfo error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return GetBinaryInfos(DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_WITH_BINARY_ICON, data,
+        remoteAbilityInfos);
+}
+
+int32_t DistributedBmsProxy::GetAbilityInfosWithBinaryIcon(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos,
+    DistributedBmsAclInfo *info)
+{
+    APP_LOGD("DistributedBmsProxy GetAbilityInfosWithBinaryIcon");
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        APP_LOGE("fail to GetAbilityInfosWithBinaryIcon due to write InterfaceToken fail");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!WriteParcelableVector(elementNames, data)) {
+        APP_LOGE("DistributedBmsProxy GetAbilityInfosWithBinaryIcon write elementName error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteString(localeInfo)) {
+        APP_LOGE("DistributedBmsProxy GetAbilityInfosWithBinaryIcon write localeInfo error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    bool hasInfo = info != nullptr;
+    if (!data.WriteBool(hasInfo)) {
+        APP_LOGE("DistributedBmsProxy GetAbilityInfosWithBinaryIcon write hasInfo error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (hasInfo && !data.WriteParcelable(info)) {
+        APP_LOGE("DistributedBmsProxy GetAbilityInfosWithBinaryIcon write info error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return GetBinaryInfos(DistributedInterfaceCode::GET_ABILITY_INFOS_WITH_BINARY_ICON, data, remoteAbilityInfos);
+}
+
+int32_t DistributedBmsProxy::GetRemoteAbilityInfosIfModified(const std::vector<ElementName> &elementNames,
+    const std::vector<std::string> &iconHashes, const std::string &localeInfo,
+    std::vector<RemoteAbilityConditionalInfo> &remoteAbilityInfos)
+{
+    APP_LOGD("DistributedBmsProxy GetRemoteAbilityInfosIfModified");
+    for (const auto &elementName : elementNames) {
+        int32_t checkRet = CheckElementName(elementName);
+        if (checkRet != ERR_OK) {
+            APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosIfModified check elementName failed");
+            return checkRet;
+        }
+    }
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        APP_LOGE("fail to GetRemoteAbilityInfosIfModified due to write InterfaceToken fail");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!WriteParcelableVector(elementNames, data)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosIfModified write elementName error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteStringVector(iconHashes)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosIfModified write iconHashes error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteString(localeInfo)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosIfModified write localeInfo error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return GetParcelableInfos<RemoteAbilityConditionalInfo>(
+        DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_IF_MODIFIED, data, remoteAbilityInfos);
+}
+
+int32_t DistributedBmsProxy::GetAbilityInfosIfModified(const std::vector<ElementName> &elementNames,
+    const std::vector<std::string> &iconHashes, const std::string &localeInfo,
+    std::vector<RemoteAbilityConditionalInfo> &remoteAbilityInfos, DistributedBmsAclInfo *info)
+{
+    APP_LOGD("DistributedBmsProxy GetAbilityInfosIfModified");
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        APP_LOGE("fail to GetAbilityInfosIfModified due to write InterfaceToken fail");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!WriteParcelableVector(elementNames, data)) {
+        APP_LOGE("DistributedBmsProxy GetAbilityInfosIfModified write elementName error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteStringVector(iconHashes)) {
+        APP_LOGE("DistributedBmsProxy GetAbilityInfosIfModified write iconHashes error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteString(localeInfo)) {
+        APP_LOGE("DistributedBmsProxy GetAbilityInfosIfModified write localeInfo error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    bool hasInfo = info != nullptr;
+    if (!data.WriteBool(hasInfo)) {
+        APP_LOGE("DistributedBmsProxy GetAbilityInfosIfModified write hasInfo error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (hasInfo && !data.WriteParcelable(info)) {
+        APP_LOGE("DistributedBmsProxy GetAbilityInfosIfModified write info error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return GetParcelableInfos<RemoteAbilityConditionalInfo>(
+        DistributedInterfaceCode::GET_ABILITY_INFOS_IF_MODIFIED, data, remoteAbilityInfos);
+}
+
+int32_t DistributedBmsProxy::GetRemoteAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+    std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+{
+    APP_LOGD("DistributedBmsProxy GetRemoteAbilityInfosPartial");
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        APP_LOGE("fail to GetRemoteAbilityInfosPartial due to write InterfaceToken fail");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!WriteParcelableVector(elementNames, data)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosPartial write elementName error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteString(localeInfo)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosPartial write localeInfo error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteParcelable(&options)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosPartial write options error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return GetParcelableInfos<RemoteAbilityInfoResult>(
+        DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_PARTIAL, data, remoteAbilityInfos);
+}
+
+int32_t DistributedBmsProxy::GetAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+    std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos,
+    DistributedBmsAclInfo *info)
+{
+    APP_LOGD("DistributedBmsProxy GetAbilityInfosPartial");
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        APP_LOGE("fail to GetAbilityInfosPartial due to write InterfaceToken fail");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!WriteParcelableVector(elementNames, data)) {
+        APP_LOGE("DistributedBmsProxy GetAbilityInfosPartial write elementName error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteString(localeInfo)) {
+        APP_LOGE("DistributedBmsProxy GetAbilityInfosPartial write localeInfo error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    bool hasInfo = info != nullptr;
+    if (!data.WriteBool(hasInfo)) {
+        APP_LOGE("DistributedBmsProxy GetAbilityInfosPartial write hasInfo error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (hasInfo && !data.WriteParcelable(info)) {
+        APP_LOGE("DistributedBmsProxy GetAbilityInfosPartial write info error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    // last so that a peer which does not know the options reads the rest as before and returns every field
+    if (!data.WriteParcelable(&options)) {
+        APP_LOGE("DistributedBmsProxy GetAbilityInfosPartial write options error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return GetParcelableInfos<RemoteAbilityInfoResult>(
+        DistributedInterfaceCode::GET_ABILITY_INFOS_PARTIAL, data, remoteAbilityInfos);
+}
+
+int32_t DistributedBmsProxy::GetRemoteAbilityInfosChunked(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const RemoteAbilityInfoOptions &options, uint64_t &continuationToken,
+    std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+{
+    APP_LOGD("DistributedBmsProxy GetRemoteAbilityInfosChunked");
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        APP_LOGE("fail to GetRemoteAbilityInfosChunked due to write InterfaceToken fail");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!WriteParcelableVector(elementNames, data)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosChunked write elementName error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteString(localeInfo)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosChunked write localeInfo error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteUint64(continuationToken)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosChunked write continuationToken error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteParcelable(&options)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosChunked write options error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    MessageParcel reply;
+    int32_t result = SendRequest(DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_CHUNKED, data, reply);
+    if (result != OHOS::NO_ERROR) {
+        APP_LOGE("reply result false");
+        return result;
+    }
+    if (!reply.ReadBool()) {
+        APP_LOGE("reply result false");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    continuationToken = reply.ReadUint64();
+    int32_t infoSize = reply.ReadInt32();
+    CONTAINER_SECURITY_VERIFY(reply, infoSize, &remoteAbilityInfos);
+    for (int32_t i = 0; i < infoSize; i++) {
+        std::unique_ptr<RemoteAbilityInfoResult> info(reply.ReadParcelable<RemoteAbilityInfoResult>());
+        if (!info) {
+            APP_LOGE("Read Parcelable infos failed");
+            return ERR_APPEXECFWK_PARCEL_ERROR;
+        }
+        remoteAbilityInfos.emplace_back(std::move(*info));
+    }
+    return OHOS::NO_ERROR;
+}
+
 bool DistributedBmsProxy::GetDistributedBundleInfo(const std::string &networkId, const std::string &bundleName,
     DistributedBundleInfo &distributedBundleInfo)
 {
@@ -308,6 +552,90 @@ int32_t DistributedBmsProxy::GetBundleVersionCode(const std::string &bundleName,
     return result;
 }
 
+int32_t DistributedBmsProxy::GetRemoteAbilityInfosAsync(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const sptr<IRemoteObject> &callback)
+{
+    APP_LOGD("DistributedBmsProxy GetRemoteAbilityInfosAsync");
+    for (const auto &elementName : elementNames) {
+        int32_t checkRet = CheckElementName(elementName);
+        if (checkRet != ERR_OK) {
+            APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosAsync check elementName failed");
+            return checkRet;
+        }
+    }
+    if (callback == nullptr) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosAsync callback is null");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        APP_LOGE("fail to GetRemoteAbilityInfosAsync due to write InterfaceToken fail");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    // the callback goes first, so the service can answer it even if the element names are rejected
+    if (!data.WriteRemoteObject(callback)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosAsync write callback error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!WriteParcelableVector(elementNames, data)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosAsync write elementName error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteString(localeInfo)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteAbilityInfosAsync write localeInfo error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return SendAsyncRequest(DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_ASYNC, data);
+}
+
+int32_t DistributedBmsProxy::GetRemoteBundleVersionCodeAsync(const std::string &deviceId,
+    const std::string &bundleName, const sptr<IRemoteObject> &callback)
+{
+    APP_LOGD("DistributedBmsProxy GetRemoteBundleVersionCodeAsync");
+    if (callback == nullptr) {
+        APP_LOGE("DistributedBmsProxy GetRemoteBundleVersionCodeAsync callback is null");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        APP_LOGE("fail to GetRemoteBundleVersionCodeAsync due to write InterfaceToken fail");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteString(deviceId) || !data.WriteString(bundleName)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteBundleVersionCodeAsync write bundleName error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteRemoteObject(callback)) {
+        APP_LOGE("DistributedBmsProxy GetRemoteBundleVersionCodeAsync write callback error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return SendAsyncRequest(DistributedInterfaceCode::GET_REMOTE_BUNDLE_VERSION_CODE_ASYNC, data);
+}
+
+int32_t DistributedBmsProxy::GetDistributedBundleInfoAsync(const std::string &networkId,
+    const std::string &bundleName, const sptr<IRemoteObject> &callback)
+{
+    APP_LOGD("DistributedBmsProxy GetDistributedBundleInfoAsync");
+    if (callback == nullptr) {
+        APP_LOGE("DistributedBmsProxy GetDistributedBundleInfoAsync callback is null");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        APP_LOGE("fail to GetDistributedBundleInfoAsync due to write InterfaceToken fail");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteString(networkId) || !data.WriteString(bundleName)) {
+        APP_LOGE("DistributedBmsProxy GetDistributedBundleInfoAsync write bundleName error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!data.WriteRemoteObject(callback)) {
+        APP_LOGE("DistributedBmsProxy GetDistributedBundleInfoAsync write callback error");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return SendAsyncRequest(DistributedInterfaceCode::GET_DISTRIBUTED_BUNDLE_INFO_ASYNC, data);
+}
+
 template<typename T>
 bool DistributedBmsProxy::WriteParcelableVector(const std::vector<T> &parcelableVector, Parcel &data)
 {
@@ -380,6 +708,27 @@ int32_t DistributedBmsProxy::GetParcelableInfos(
     return OHOS::NO_ERROR;
 }
 
+int32_t DistributedBmsProxy::GetBinaryInfos(DistributedInterfaceCode code, MessageParcel &data,
+    std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos)
+{
+    MessageParcel reply;
+    int32_t result = SendRequest(code, data, reply);
+    if (result != OHOS::NO_ERROR) {
+        APP_LOGE("reply result false");
+        return result;
+    }
+    if (!reply.ReadBool()) {
+        APP_LOGE("reply result false");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!RemoteAbilityBinaryInfo::ReadInfosFromParcel(reply, remoteAbilityInfos)) {
+        APP_LOGE("Read binary infos failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    APP_LOGD("get binary infos success");
+    return OHOS::NO_ERROR;
+}
+
 int32_t DistributedBmsProxy::SendRequest(DistributedInterfaceCode code, MessageParcel &data, MessageParcel &reply)
 {
     APP_LOGD("DistributedBmsProxy SendRequest");
@@ -389,6 +738,38 @@ int32_t DistributedBmsProxy::SendRequest(DistributedInterfaceCode code, MessageP
         APP_LOGE("fail to send %{public}d cmd to service due to remote object is null", code);
         return ERR_APPEXECFWK_FAILED_GET_REMOTE_PROXY;
     }
+    // the deadline of the calling thread bounds the wait and is written last, a service that does not read it
+    // ignores the trailing bytes
+    int64_t remainingMs = DistributedBmsDeadline::GetRemainingMs();
+    if (remainingMs == 0) {
+        APP_LOGE("fail to send %{public}d cmd to service due to deadline exceeded", code);
+        return ERR_DBMS_DEADLINE_EXCEEDED;
+    }
+    if (remainingMs > 0) {
+        if (!data.WriteInt64(remainingMs)) {
+            APP_LOGE("fail to send %{public}d cmd to service due to write deadline fail", code);
+            return ERR_APPEXECFWK_PARCEL_ERROR;
+        }
+        option.SetWaitTime(static_cast<int>((remainingMs + MILLISECONDS_PER_SECOND - 1) / MILLISECONDS_PER_SECOND));
+    }
+    int32_t result = remote->SendRequest(static_cast<uint32_t>(code), data, reply, option);
+    if (result != OHOS::NO_ERROR) {
+        APP_LOGE("fail to send %{public}d cmd to service due to transact error:%{public}d", code, result);
+    }
+    return result;
+}
+
+int32_t DistributedBmsProxy::SendAsyncRequest(DistributedInterfaceCode code, MessageParcel &data)
+{
+    APP_LOGD("DistributedBmsProxy SendAsyncRequest");
+    sptr<IRemoteObject> remote = Remote();
+    if (remote == nullptr) {
+        APP_LOGE("fail to send %{public}d cmd to service due to remote object is null", code);
+        return ERR_APPEXECFWK_FAILED_GET_REMOTE_PROXY;
+    }
+    // one-way, the calling thread only waits for the request to be queued and the result comes to the callback
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
     int32_t result = remote->SendRequest(static_cast<uint32_t>(code), data, reply, option);
     if (result != OHOS::NO_ERROR) {
         APP_LOGE("fail to send %{public}d cmd to service due to transact error:%{public}d", code, result);
@@ -98,6 +98,43 @@ int32_t DistributedBundleMgrClient::GetRemoteAbilityInfos(const std::vector<Elem
     return proxy->GetRemoteAbilityInfos(elementNames, localeInfo, remoteAbilityInfos);
 }
 
+int32_t DistributedBundleMgrClient::GetRemoteAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+    std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+{
+    auto proxy = GetDistributedBundleMgrProxy();
+    if (proxy == nullptr) {
+        APP_LOGE_NOFUNC("GetDistributedBundleMgrProxy failed");
+        return ERROR_DISTRIBUTED_SERVICE_NOT_RUNNING;
+    }
+    return proxy->GetRemoteAbilityInfosPartial(elementNames, localeInfo, options, remoteAbilityInfos);
+}
+
+int32_t DistributedBundleMgrClient::GetRemoteAbilityInfosChunked(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+    const std::function<bool(std::vector<RemoteAbilityInfoResult> &)> &onChunk)
+{
+    auto proxy = GetDistributedBundleMgrProxy();
+    if (proxy == nullptr) {
+        APP_LOGE_NOFUNC("GetDistributedBundleMgrProxy failed");
+        return ERROR_DISTRIBUTED_SERVICE_NOT_RUNNING;
+    }
+    uint64_t continuationToken = 0;
+    std::vector<RemoteAbilityInfoResult> remoteAbilityInfos;
+    int32_t result = proxy->GetRemoteAbilityInfosChunked(elementNames, localeInfo, options, continuationToken,
+        remoteAbilityInfos);
+    while (result == ERR_OK) {
+        if (!onChunk(remoteAbilityInfos) || continuationToken == 0) {
+            break;
+        }
+        // the service keeps the element names and the options, only the token is sent again
+        remoteAbilityInfos.clear();
+        result = proxy->GetRemoteAbilityInfosChunked({}, "", RemoteAbilityInfoOptions(), continuationToken,
+            remoteAbilityInfos);
+    }
+    return result;
+}
+
 bool DistributedBundleMgrClient::GetDistributedBundleInfo(const std::string &networkId, const std::string &bundleName,
     DistributedBundleInfo &distributedBundleInfo)
 {
@@ -132,13 +169,174 @@ int32_t DistributedBundleMgrClient::GetRemoteBundleVersionCode(const std::string
     return proxy->GetRemoteBundleVersionCode(deviceId, bundleName, versionCode);
 }
 
+int32_t DistributedBundleMgrClient::GetRemoteAbilityInfoAsync(const ElementName &elementName,
+    const std::string &localeInfo, const RemoteAbilityInfoCallback &callback)
+{
+    return GetRemoteAbilityInfosAsync({ elementName }, localeInfo,
+        [callback](int32_t resultCode, const std::vector<RemoteAbilityInfo> &remoteAbilityInfos) {
+            if (resultCode != ERR_OK) {
+                callback(resultCode, RemoteAbilityInfo());
+                return;
+            }
+            if (remoteAbilityInfos.size() != 1) {
+                APP_LOGE_NOFUNC("invalid size of remoteAbilityInfos");
+                callback(ERR_APPEXECFWK_PARCEL_ERROR, RemoteAbilityInfo());
+                return;
+            }
+            callback(resultCode, remoteAbilityInfos[0]);
+        });
+}
+
+int32_t DistributedBundleMgrClient::GetRemoteAbilityInfosAsync(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const RemoteAbilityInfosCallback &callback)
+{
+    auto queryCallback = CreateAsyncQueryCallback();
+    if (queryCallback == nullptr || callback == nullptr) {
+        APP_LOGE_NOFUNC("invalid callback");
+        return ERR_APPEXECFWK_NULL_PTR;
+    }
+    queryCallback->onAbilityInfos = callback;
+    return SendAsyncQuery(queryCallback,
+        [&elementNames, &localeInfo](const sptr<IDistributedBms> &proxy, const sptr<IRemoteObject> &object) {
+            return proxy->GetRemoteAbilityInfosAsync(elementNames, localeInfo, object);
+        });
+}
+
+int32_t DistributedBundleMgrClient::GetRemoteBundleVersionCodeAsync(const std::string &deviceId,
+    const std::string &bundleName, const RemoteBundleVersionCodeCallback &callback)
+{
+    auto queryCallback = CreateAsyncQueryCallback();
+    if (queryCallback == nullptr || callback == nullptr) {
+        APP_LOGE_NOFUNC("invalid callback");
+        return ERR_APPEXECFWK_NULL_PTR;
+    }
+    queryCallback->onVersionCode = callback;
+    return SendAsyncQuery(queryCallback,
+        [&deviceId, &bundleName](const sptr<IDistributedBms> &proxy, const sptr<IRemoteObject> &object) {
+            return proxy->GetRemoteBundleVersionCodeAsync(deviceId, bundleName, object);
+        });
+}
+
+int32_t DistributedBundleMgrClient::GetDistributedBundleInfoAsync(const std::string &networkId,
+    const std::string &bundleName, const DistributedBundleInfoCallback &callback)
+{
+    auto queryCallback = CreateAsyncQueryCallback();
+    if (queryCallback == nullptr || callback == nullptr) {
+        APP_LOGE_NOFUNC("invalid callback");
+        return ERR_APPEXECFWK_NULL_PTR;
+    }
+    queryCallback->onBundleInfo = callback;
+    return SendAsyncQuery(queryCallback,
+        [&networkId, &bundleName](const sptr<IDistributedBms> &proxy, const sptr<IRemoteObject> &object) {
+            return proxy->GetDistributedBundleInfoAsync(networkId, bundleName, object);
+        });
+}
+
+sptr<DistributedBundleMgrClient::AsyncQueryCallback> DistributedBundleMgrClient::CreateAsyncQueryCallback()
+{
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    return new (std::nothrow) AsyncQueryCallback(this, ++nextCallbackId_);
+}
+
+int32_t DistributedBundleMgrClient::SendAsyncQuery(const sptr<AsyncQueryCallback> &queryCallback,
+    const std::function<int32_t(const sptr<IDistributedBms> &, const sptr<IRemoteObject> &)> &send)
+{
+    auto proxy = GetDistributedBundleMgrProxy();
+    if (proxy == nullptr) {
+        APP_LOGE_NOFUNC("GetDistributedBundleMgrProxy failed");
+        return ERROR_DISTRIBUTED_SERVICE_NOT_RUNNING;
+    }
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        pendingCallbacks_[queryCallback->GetId()] = queryCallback;
+    }
+    int32_t ret = send(proxy, queryCallback->AsObject());
+    // a query already failed by the death of the service has had its answer, so it counts as sent
+    if (ret != ERR_OK && queryCallback->Finish()) {
+        APP_LOGE_NOFUNC("send async query failed:%{public}d", ret);
+        return ret;
+    }
+    return ERR_OK;
+}
+
+void DistributedBundleMgrClient::RemovePendingCallback(uint64_t id)
+{
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    pendingCallbacks_.erase(id);
+}
+
 void DistributedBundleMgrClient::ResetDistributedBundleMgrProxy()
 {
-    std::lock_guard<std::mutex> lock(dProxyMutex_);
-    if ((dProxy_ != nullptr) && (dProxy_->AsObject() != nullptr)) {
-        dProxy_->AsObject()->RemoveDeathRecipient(recipient_);
+    {
+        std::lock_guard<std::mutex> lock(dProxyMutex_);
+        if ((dProxy_ != nullptr) && (dProxy_->AsObject() != nullptr)) {
+            dProxy_->AsObject()->RemoveDeathRecipient(recipient_);
+        }
+        dProxy_ = nullptr;
+    }
+    // the service is gone with the queries it holds, so their callbacks would never be called
+    std::map<uint64_t, sptr<AsyncQueryCallback>> pendingCallbacks;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        pendingCallbacks.swap(pendingCallbacks_);
+    }
+    if (!pendingCallbacks.empty()) {
+        APP_LOGW_NOFUNC("fail %{public}d pending queries", static_cast<int32_t>(pendingCallbacks.size()));
+    }
+    for (auto &item : pendingCallbacks) {
+        item.second->Fail(ERROR_DISTRIBUTED_SERVICE_NOT_RUNNING);
+    }
+}
+
+void DistributedBundleMgrClient::AsyncQueryCallback::OnRemoteAbilityInfosResult(int32_t resultCode,
+    const std::vector<RemoteAbilityInfo> &remoteAbilityInfos)
+{
+    if (Finish() && onAbilityInfos != nullptr) {
+        onAbilityInfos(resultCode, remoteAbilityInfos);
+    }
+}
+
+void DistributedBundleMgrClient::AsyncQueryCallback::OnRemoteBundleVersionCodeResult(int32_t resultCode,
+    uint32_t versionCode)
+{
+    if (Finish() && onVersionCode != nullptr) {
+        onVersionCode(resultCode, versionCode);
+    }
+}
+
+void DistributedBundleMgrClient::AsyncQueryCallback::OnDistributedBundleInfoResult(bool result,
+    const DistributedBundleInfo &distributedBundleInfo)
+{
+    if (Finish() && onBundleInfo != nullptr) {
+        onBundleInfo(result, distributedBundleInfo);
+    }
+}
+
+void DistributedBundleMgrClient::AsyncQueryCallback::Fail(int32_t resultCode)
+{
+    if (!Finish()) {
+        return;
     }
-    dProxy_ = nullptr;
+    if (onAbilityInfos != nullptr) {
+        onAbilityInfos(resultCode, {});
+    }
+    if (onVersionCode != nullptr) {
+        onVersionCode(resultCode, 0);
+    }
+    if (onBundleInfo != nullptr) {
+        onBundleInfo(false, DistributedBundleInfo());
+    }
+}
+
+bool DistributedBundleMgrClient::AsyncQueryCallback::Finish()
+{
+    if (finished_.exchange(true)) {
+        return false;
+    }
+    if (client_ != nullptr) {
+        client_->RemovePendingCallback(id_);
+    }
+    return true;
 }
 
 sptr<IDistributedBms> DistributedBundleMgrClient::GetDistributedBundleMgrProxy()
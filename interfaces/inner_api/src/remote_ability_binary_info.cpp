@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "remote_ability_binary_info.h"
+
+#include <algorithm>
+
+#include "app_log_wrapper.h"
+#include "parcel_macro.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+constexpr uint32_t MAX_ICON_SIZE = 16 * 1024 * 1024;
+// the limit of a raw data block of MessageParcel
+constexpr uint64_t MAX_ICON_BLOB_SIZE = 128 * 1024 * 1024;
+
+bool ReadInfoFromParcel(MessageParcel &parcel, RemoteAbilityBinaryInfo &info, uint32_t &iconSize)
+{
+    std::unique_ptr<ElementName> element(parcel.ReadParcelable<ElementName>());
+    if (element == nullptr) {
+        APP_LOGE("read elementName failed");
+        return false;
+    }
+    info.elementName = *element;
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, info.label);
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, info.iconType);
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, iconSize);
+    if (iconSize > MAX_ICON_SIZE) {
+        APP_LOGE("icon size %{public}u exceeds the limit", iconSize);
+        return false;
+    }
+    return true;
+}
+
+bool WriteInfoToParcel(const RemoteAbilityBinaryInfo &info, MessageParcel &parcel)
+{
+    if (info.icon.size() > MAX_ICON_SIZE) {
+        APP_LOGE("icon size %{public}d exceeds the limit", static_cast<int32_t>(info.icon.size()));
+        return false;
+    }
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Parcelable, parcel, &info.elementName);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, info.label);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, info.iconType);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, static_cast<uint32_t>(info.icon.size()));
+    return true;
+}
+}
+
+bool RemoteAbilityBinaryInfo::ReadInfosFromParcel(MessageParcel &parcel, std::vector<RemoteAbilityBinaryInfo> &infos)
+{
+    int32_t infoSize = 0;
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, infoSize);
+    CONTAINER_SECURITY_VERIFY(parcel, infoSize, &infos);
+    size_t first = infos.size();
+    std::vector<uint32_t> iconSizes;
+    uint64_t blobSize = 0;
+    for (int32_t i = 0; i < infoSize; i++) {
+        RemoteAbilityBinaryInfo info;
+        uint32_t iconSize = 0;
+        if (!ReadInfoFromParcel(parcel, info, iconSize)) {
+            return false;
+        }
+        iconSizes.emplace_back(iconSize);
+        blobSize += iconSize;
+        infos.emplace_back(std::move(info));
+    }
+    uint32_t writtenBlobSize = 0;
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, writtenBlobSize);
+    if (writtenBlobSize != blobSize) {
+        APP_LOGE("icon blob size %{public}u does not match the icons", writtenBlobSize);
+        return false;
+    }
+    if (blobSize == 0) {
+        return true;
+    }
+    bool isRawData = false;
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Bool, parcel, isRawData);
+    const uint8_t *blob = isRawData ? reinterpret_cast<const uint8_t *>(parcel.ReadRawData(writtenBlobSize)) :
+        parcel.ReadUnpadBuffer(writtenBlobSize);
+    if (blob == nullptr) {
+        APP_LOGE("read icon blob failed");
+        return false;
+    }
+    size_t offset = 0;
+    for (size_t i = 0; i < iconSizes.size(); i++) {
+        infos[first + i].icon.assign(blob + offset, blob + offset + iconSizes[i]);
+        offset += iconSizes[i];
+    }
+    return true;
+}
+
+bool RemoteAbilityBinaryInfo::MarshallingInfos(const std::vector<RemoteAbilityBinaryInfo> &infos,
+    MessageParcel &parcel, bool allowRawData)
+{
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, static_cast<int32_t>(infos.size()));
+    uint64_t blobSize = 0;
+    size_t iconCount = 0;
+    for (const auto &info : infos) {
+        if (!WriteInfoToParcel(info, parcel)) {
+            return false;
+        }
+        blobSize += info.icon.size();
+        iconCount += info.icon.empty() ? 0 : 1;
+    }
+    if (blobSize > MAX_ICON_BLOB_SIZE) {
+        APP_LOGE("icon blob size %{public}llu exceeds the limit", static_cast<unsigned long long>(blobSize));
+        return false;
+    }
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, static_cast<uint32_t>(blobSize));
+    if (blobSize == 0) {
+        return true;
+    }
+    // a parcel holds one ashmem block and ashmem does not cross devices, so the icons go as one blob and inline
+    // for a remote device
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Bool, parcel, allowRawData);
+    if (!allowRawData) {
+        for (const auto &info : infos) {
+            if (!info.icon.empty() && !parcel.WriteUnpadBuffer(info.icon.data(), info.icon.size())) {
+                APP_LOGE("write icon blob failed");
+                return false;
+            }
+        }
+        return true;
+    }
+    if (iconCount == 1) {
+        auto info = std::find_if(infos.begin(), infos.end(),
+            [](const RemoteAbilityBinaryInfo &info) { return !info.icon.empty(); });
+        if (!parcel.WriteRawData(info->icon.data(), info->icon.size())) {
+            APP_LOGE("write icon blob failed");
+            return false;
+        }
+        return true;
+    }
+    std::vector<uint8_t> blob;
+    blob.reserve(blobSize);
+    for (const auto &info : infos) {
+        blob.insert(blob.end(), info.icon.begin(), info.icon.end());
+    }
+    if (!parcel.WriteRawData(blob.data(), blob.size())) {
+        APP_LOGE("write icon blob failed");
+        return false;
+    }
+    return true;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
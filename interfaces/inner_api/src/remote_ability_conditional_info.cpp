@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "remote_ability_conditional_info.h"
+
+#include "app_log_wrapper.h"
+#include "parcel_macro.h"
+#include "string_ex.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+bool RemoteAbilityConditionalInfo::ReadFromParcel(Parcel &parcel)
+{
+    std::unique_ptr<RemoteAbilityInfo> info(parcel.ReadParcelable<RemoteAbilityInfo>());
+    if (info == nullptr) {
+        APP_LOGE("read remoteAbilityInfo failed");
+        return false;
+    }
+    remoteAbilityInfo = *info;
+    iconHash = Str16ToStr8(parcel.ReadString16());
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Bool, parcel, iconModified);
+    return true;
+}
+
+RemoteAbilityConditionalInfo *RemoteAbilityConditionalInfo::Unmarshalling(Parcel &parcel)
+{
+    RemoteAbilityConditionalInfo *info = new (std::nothrow) RemoteAbilityConditionalInfo();
+    if (info && !info->ReadFromParcel(parcel)) {
+        APP_LOGW("read from parcel failed");
+        delete info;
+        info = nullptr;
+    }
+    return info;
+}
+
+bool RemoteAbilityConditionalInfo::Marshalling(Parcel &parcel) const
+{
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Parcelable, parcel, &remoteAbilityInfo);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String16, parcel, Str8ToStr16(iconHash));
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Bool, parcel, iconModified);
+    return true;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
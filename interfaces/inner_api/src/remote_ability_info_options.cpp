@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "remote_ability_info_options.h"
+
+#include "app_log_wrapper.h"
+#include "parcel_macro.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+bool RemoteAbilityInfoOptions::IsValid() const
+{
+    return (fields & REMOTE_ABILITY_INFO_FIELD_ALL) != 0 && (fields & ~REMOTE_ABILITY_INFO_FIELD_ALL) == 0 &&
+        maxIconEdge >= 0;
+}
+
+bool RemoteAbilityInfoOptions::ReadFromParcel(Parcel &parcel)
+{
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, fields);
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, maxIconEdge);
+    return true;
+}
+
+RemoteAbilityInfoOptions *RemoteAbilityInfoOptions::Unmarshalling(Parcel &parcel)
+{
+    RemoteAbilityInfoOptions *options = new (std::nothrow) RemoteAbilityInfoOptions();
+    if (options && !options->ReadFromParcel(parcel)) {
+        APP_LOGW("read from parcel failed");
+        delete options;
+        options = nullptr;
+    }
+    return options;
+}
+
+bool RemoteAbilityInfoOptions::Marshalling(Parcel &parcel) const
+{
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, fields);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, maxIconEdge);
+    return true;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
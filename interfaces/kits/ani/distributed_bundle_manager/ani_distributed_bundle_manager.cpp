@@ -46,8 +46,7 @@ static ani_object GetRemoteAbilityInfoInner(ani_env *env,
     }
 
     if (elementNames.size() > GET_REMOTE_ABILITY_INFO_MAX_SIZE) {
-        BusinessErrorAni::ThrowError(env, ERROR_PARAM_CHECK_ERROR,
-            "BusinessError 401: The number of ElementNames is greater than 10");
+        BusinessErrorAni::ThrowError(env, ERROR_PARAM_CHECK_ERROR, ELEMENT_NAMES_SIZE_ERROR);
         return nullptr;
     }
 
@@ -85,6 +84,57 @@ static ani_object AniGetRemoteAbilityInfos(ani_env *env, ani_object aniElementNa
     return GetRemoteAbilityInfoInner(env, aniElementNames, aniLocale, true);
 }
 
+static ani_object AniGetRemoteAbilityInfosPartial(ani_env *env, ani_object aniElementNames, ani_string aniLocale,
+    ani_int aniFields, ani_int aniMaxIconEdge)
+{
+    APP_LOGD("ani GetRemoteAbilityInfosPartial called");
+    std::vector<ElementName> elementNames;
+    if (!CommonFunAni::ParseAniArray(env, aniElementNames, elementNames, CommonFunAni::ParseElementName)) {
+        APP_LOGE("ParseAniArray ElementNames failed");
+        BusinessErrorAni::ThrowCommonError(env, ERROR_PARAM_CHECK_ERROR, PARAMETER_ELEMENT_NAME, TYPE_OBJECT);
+        return nullptr;
+    }
+
+    std::string locale;
+    if (!CommonFunAni::ParseString(env, aniLocale, locale)) {
+        APP_LOGE("parse locale failed");
+        BusinessErrorAni::ThrowCommonError(env, ERROR_PARAM_CHECK_ERROR, PARAMETER_LOCALE, TYPE_STRING);
+        return nullptr;
+    }
+
+    RemoteAbilityInfoOptions options;
+    options.fields = static_cast<uint32_t>(aniFields);
+    options.maxIconEdge = static_cast<int32_t>(aniMaxIconEdge);
+    if (!options.IsValid()) {
+        APP_LOGE("invalid options");
+        BusinessErrorAni::ThrowCommonError(env, ERROR_PARAM_CHECK_ERROR, PARAMETER_OPTIONS, TYPE_OBJECT);
+        return nullptr;
+    }
+
+    if (elementNames.size() > GET_REMOTE_ABILITY_INFO_MAX_SIZE) {
+        BusinessErrorAni::ThrowError(env, ERROR_PARAM_CHECK_ERROR, ELEMENT_NAMES_SIZE_ERROR);
+        return nullptr;
+    }
+
+    std::vector<RemoteAbilityInfoResult> remoteAbilityInfos;
+    int32_t ret = DistributedHelper::InnerGetRemoteAbilityInfosPartial(elementNames, locale, options,
+        remoteAbilityInfos);
+    if (ret != ERR_OK) {
+        APP_LOGE("InnerGetRemoteAbilityInfosPartial failed ret: %{public}d", ret);
+        BusinessErrorAni::ThrowCommonError(env, ret,
+            RESOURCE_NAME_GET_REMOTE_ABILITY_INFOS_PARTIAL, Constants::PERMISSION_GET_BUNDLE_INFO_PRIVILEGED);
+        return nullptr;
+    }
+
+    ani_object remoteAbilityInfosObject = CommonFunAni::ConvertAniArray(env, remoteAbilityInfos,
+        AniDistributedbundleManagerCommon::ConvertRemoteAbilityInfoResult);
+    if (remoteAbilityInfosObject == nullptr) {
+        APP_LOGE("nullptr remoteAbilityInfosObject");
+        return nullptr;
+    }
+    return remoteAbilityInfosObject;
+}
+
 static ani_long AniGetRemoteBundleVersionCode(ani_env *env, ani_string aniDeviceId, ani_string aniBundleName)
 {
     APP_LOGD("ani GetRemoteBundleVersionCode called");
@@ -159,6 +209,8 @@ ANI_EXPORT ani_status ANI_Constructor(ani_vm* vm, uint32_t* result)
         ani_native_function { "getRemoteAbilityInfoNative", nullptr, reinterpret_cast<void*>(AniGetRemoteAbilityInfo) },
         ani_native_function { "getRemoteAbilityInfosNative", nullptr,
             reinterpret_cast<void*>(AniGetRemoteAbilityInfos) },
+        ani_native_function { "getRemoteAbilityInfosPartialNative", nullptr,
+            reinterpret_cast<void*>(AniGetRemoteAbilityInfosPartial) },
         ani_native_function { "getRemoteBundleVersionCodeNative", nullptr,
             reinterpret_cast<void*>(AniGetRemoteBundleVersionCode) }
     };
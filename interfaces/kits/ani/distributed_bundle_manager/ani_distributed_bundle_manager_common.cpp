@@ -25,6 +25,9 @@ namespace {
 constexpr const char* CLASSNAME_ELEMENT_NAME = "bundleManager.ElementName.ElementName";
 constexpr const char* CLASSNAME_ELEMENT_NAME_INNER = "bundleManager.ElementNameInner.ElementNameInner";
 constexpr const char* CLASSNAME_REMOTE_ABILITY_INFO = "bundleManager.RemoteAbilityInfoInner.RemoteAbilityInfoInner";
+constexpr const char* CLASSNAME_REMOTE_ABILITY_INFO_INTERFACE = "bundleManager.RemoteAbilityInfo.RemoteAbilityInfo";
+constexpr const char* CLASSNAME_REMOTE_ABILITY_INFO_RESULT =
+    "bundleManager.RemoteAbilityInfoResultInner.RemoteAbilityInfoResultInner";
 }
 
 ani_object ConvertDistributedBundleElementName(ani_env* env, const ElementName& elementName)
@@ -109,6 +112,26 @@ ani_object ConvertRemoteAbilityInfo(ani_env* env, const RemoteAbilityInfo& remot
             .BuildSignatureDescriptor();
     return CommonFunAni::CreateNewObjectByClassV2(env, CLASSNAME_REMOTE_ABILITY_INFO, ctorSig, args);
 }
+
+ani_object ConvertRemoteAbilityInfoResult(ani_env* env, const RemoteAbilityInfoResult& remoteAbilityInfoResult)
+{
+    RETURN_NULL_IF_NULL(env);
+
+    // remoteAbilityInfo: RemoteAbilityInfo
+    ani_object remoteAbilityInfo = ConvertRemoteAbilityInfo(env, remoteAbilityInfoResult.remoteAbilityInfo);
+    RETURN_NULL_IF_NULL(remoteAbilityInfo);
+
+    ani_value args[] = {
+        { .i = remoteAbilityInfoResult.resultCode },
+        { .r = remoteAbilityInfo },
+    };
+    static const std::string ctorSig =
+        arkts::ani_signature::SignatureBuilder()
+            .AddInt()                                           // code: int
+            .AddClass(CLASSNAME_REMOTE_ABILITY_INFO_INTERFACE)  // remoteAbilityInfo: RemoteAbilityInfo
+            .BuildSignatureDescriptor();
+    return CommonFunAni::CreateNewObjectByClassV2(env, CLASSNAME_REMOTE_ABILITY_INFO_RESULT, ctorSig, args);
+}
 } // AniDistributedbundleManagerCommon
 } // AppExecFwk
 } // OHOS
\ No newline at end of file
@@ -22,12 +22,14 @@
 
 #include "element_name.h"
 #include "remote_ability_info.h"
+#include "remote_ability_info_result.h"
 
 namespace OHOS {
 namespace AppExecFwk {
 namespace AniDistributedbundleManagerCommon {
     ani_object ConvertDistributedBundleElementName(ani_env* env, const ElementName& elementName);
     ani_object ConvertRemoteAbilityInfo(ani_env* env, const RemoteAbilityInfo& remoteAbilityInfo);
+    ani_object ConvertRemoteAbilityInfoResult(ani_env* env, const RemoteAbilityInfoResult& remoteAbilityInfoResult);
 } // AniDistributedbundleManagerCommon
 } // AppExecFwk
 } // OHOS
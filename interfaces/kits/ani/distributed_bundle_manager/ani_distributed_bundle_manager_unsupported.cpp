@@ -39,6 +39,15 @@ ani_object AniGetRemoteAbilityInfos(ani_env *env, ani_object aniElementNames, an
     return nullptr;
 }
 
+ani_object AniGetRemoteAbilityInfosPartial(ani_env *env, ani_object aniElementNames, ani_string aniLocale,
+    ani_int aniFields, ani_int aniMaxIconEdge)
+{
+    APP_LOGI("SystemCapability.BundleManager.DistributedBundleFramework not supported.");
+    BusinessErrorAni::ThrowCommonError(env, ERROR_SYSTEM_ABILITY_NOT_FOUND,
+        RESOURCE_NAME_GET_REMOTE_ABILITY_INFOS_PARTIAL, "");
+    return nullptr;
+}
+
 ani_long AniGetRemoteBundleVersionCode(ani_env *env, ani_string aniDeviceId, ani_string aniBundleName)
 {
     APP_LOGI("SystemCapability.BundleManager.DistributedBundleFramework not supported.");
@@ -67,6 +76,8 @@ ANI_EXPORT ani_status ANI_Constructor(ani_vm* vm, uint32_t* result)
         ani_native_function { "getRemoteAbilityInfoNative", nullptr, reinterpret_cast<void*>(AniGetRemoteAbilityInfo) },
         ani_native_function { "getRemoteAbilityInfosNative", nullptr,
             reinterpret_cast<void*>(AniGetRemoteAbilityInfos) },
+        ani_native_function { "getRemoteAbilityInfosPartialNative", nullptr,
+            reinterpret_cast<void*>(AniGetRemoteAbilityInfosPartial) },
         ani_native_function { "getRemoteBundleVersionCodeNative", nullptr,
             reinterpret_cast<void*>(AniGetRemoteBundleVersionCode) }
     };
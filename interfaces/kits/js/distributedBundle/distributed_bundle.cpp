@@ -99,6 +99,26 @@ static void ConvertRemoteAbilityInfos(
     }
 }
 
+static void ConvertRemoteAbilityInfoResults(
+    napi_env env, const std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos, napi_value objRemoteAbilityInfos)
+{
+    size_t index = 0;
+    for (const auto &remoteAbilityInfo : remoteAbilityInfos) {
+        napi_value objRemoteAbilityInfoResult = nullptr;
+        NAPI_CALL_RETURN_VOID(env, napi_create_object(env, &objRemoteAbilityInfoResult));
+        napi_value nCode;
+        NAPI_CALL_RETURN_VOID(env, napi_create_int32(env, remoteAbilityInfo.resultCode, &nCode));
+        NAPI_CALL_RETURN_VOID(env, napi_set_named_property(env, objRemoteAbilityInfoResult, "code", nCode));
+        napi_value objRemoteAbilityInfo = nullptr;
+        NAPI_CALL_RETURN_VOID(env, napi_create_object(env, &objRemoteAbilityInfo));
+        ConvertRemoteAbilityInfo(env, remoteAbilityInfo.remoteAbilityInfo, objRemoteAbilityInfo);
+        NAPI_CALL_RETURN_VOID(env, napi_set_named_property(env, objRemoteAbilityInfoResult, "remoteAbilityInfo",
+            objRemoteAbilityInfo));
+        NAPI_CALL_RETURN_VOID(env, napi_set_element(env, objRemoteAbilityInfos, index, objRemoteAbilityInfoResult));
+        index++;
+    }
+}
+
 static bool ParseElementName(napi_env env, napi_value args, OHOS::AppExecFwk::ElementName &elementName)
 {
     APP_LOGD("begin to parse ElementName");
@@ -139,6 +159,37 @@ static bool ParseElementName(napi_env env, napi_value args, OHOS::AppExecFwk::El
     return true;
 }
 
+static bool ParseInt32Property(napi_env env, napi_value args, const char *propertyName, int32_t &value)
+{
+    bool hasProperty = false;
+    NAPI_CALL_BASE(env, napi_has_named_property(env, args, propertyName, &hasProperty), false);
+    if (!hasProperty) {
+        return true;
+    }
+    napi_value property = nullptr;
+    NAPI_CALL_BASE(env, napi_get_named_property(env, args, propertyName, &property), false);
+    return CommonFunc::ParseInt(env, property, value);
+}
+
+static bool ParseRemoteAbilityInfoOptions(napi_env env, napi_value args, RemoteAbilityInfoOptions &options)
+{
+    APP_LOGD("begin to parse RemoteAbilityInfoOptions");
+    napi_valuetype valueType = napi_undefined;
+    NAPI_CALL_BASE(env, napi_typeof(env, args, &valueType), false);
+    if (valueType != napi_object) {
+        APP_LOGE("args not object type");
+        return false;
+    }
+    int32_t fields = static_cast<int32_t>(options.fields);
+    if (!ParseInt32Property(env, args, "fields", fields) ||
+        !ParseInt32Property(env, args, "maxIconEdge", options.maxIconEdge)) {
+        APP_LOGE("parse RemoteAbilityInfoOptions failed");
+        return false;
+    }
+    options.fields = static_cast<uint32_t>(fields);
+    return options.IsValid();
+}
+
 static bool ParseElementNames(napi_env env, napi_value args, bool &isArray, std::vector<ElementName> &elementNames)
 {
     APP_LOGD("begin to parse ElementNames");
@@ -260,8 +311,7 @@ napi_value GetRemoteAbilityInfo(napi_env env, napi_callback_info info)
         }
     }
     if (asyncCallbackInfo->elementNames.size() > GET_REMOTE_ABILITY_INFO_MAX_SIZE) {
-        BusinessError::ThrowError(env, ERROR_PARAM_CHECK_ERROR,
-            "BusinessError 401: The number of ElementNames is greater than 10");
+        BusinessError::ThrowError(env, ERROR_PARAM_CHECK_ERROR, ELEMENT_NAMES_SIZE_ERROR);
         return nullptr;
     }
     auto promise = CommonFunc::AsyncCallNativeMethod<GetRemoteAbilityInfoCallbackInfo>(env, asyncCallbackInfo,
@@ -271,6 +321,99 @@ napi_value GetRemoteAbilityInfo(napi_env env, napi_callback_info info)
     return promise;
 }
 
+void GetRemoteAbilityInfosPartialExec(napi_env env, void *data)
+{
+    GetRemoteAbilityInfosPartialCallbackInfo *asyncCallbackInfo =
+        reinterpret_cast<GetRemoteAbilityInfosPartialCallbackInfo*>(data);
+    if (asyncCallbackInfo == nullptr) {
+        APP_LOGE("asyncCallbackInfo is null");
+        return;
+    }
+    asyncCallbackInfo->err = DistributedHelper::InnerGetRemoteAbilityInfosPartial(asyncCallbackInfo->elementNames,
+        asyncCallbackInfo->locale, asyncCallbackInfo->options, asyncCallbackInfo->remoteAbilityInfos);
+}
+
+void GetRemoteAbilityInfosPartialComplete(napi_env env, napi_status status, void *data)
+{
+    GetRemoteAbilityInfosPartialCallbackInfo *asyncCallbackInfo =
+        reinterpret_cast<GetRemoteAbilityInfosPartialCallbackInfo*>(data);
+    if (asyncCallbackInfo == nullptr) {
+        APP_LOGE("asyncCallbackInfo is null in %{public}s", __func__);
+        return;
+    }
+    std::unique_ptr<GetRemoteAbilityInfosPartialCallbackInfo> callbackPtr {asyncCallbackInfo};
+    napi_value result[ARGS_SIZE_TWO] = {0};
+    if (asyncCallbackInfo->err == SUCCESS) {
+        NAPI_CALL_RETURN_VOID(env, napi_get_null(env, &result[0]));
+        NAPI_CALL_RETURN_VOID(env, napi_create_array(env, &result[ARGS_SIZE_ONE]));
+        ConvertRemoteAbilityInfoResults(env, asyncCallbackInfo->remoteAbilityInfos, result[ARGS_SIZE_ONE]);
+    } else {
+        result[0] = BusinessError::CreateCommonError(env, asyncCallbackInfo->err,
+            RESOURCE_NAME_GET_REMOTE_ABILITY_INFOS_PARTIAL, Constants::PERMISSION_GET_BUNDLE_INFO_PRIVILEGED);
+    }
+    if (asyncCallbackInfo->deferred) {
+        if (asyncCallbackInfo->err == SUCCESS) {
+            NAPI_CALL_RETURN_VOID(env, napi_resolve_deferred(env, asyncCallbackInfo->deferred, result[ARGS_SIZE_ONE]));
+        } else {
+            NAPI_CALL_RETURN_VOID(env, napi_reject_deferred(env, asyncCallbackInfo->deferred, result[0]));
+        }
+    } else {
+        napi_value callback = nullptr;
+        napi_value placeHolder = nullptr;
+        NAPI_CALL_RETURN_VOID(env, napi_get_reference_value(env, asyncCallbackInfo->callback, &callback));
+        NAPI_CALL_RETURN_VOID(env, napi_call_function(env, nullptr, callback,
+            sizeof(result) / sizeof(result[0]), result, &placeHolder));
+    }
+}
+
+napi_value GetRemoteAbilityInfosPartial(napi_env env, napi_callback_info info)
+{
+    APP_LOGD("begin to GetRemoteAbilityInfosPartial");
+    NapiArg args(env, info);
+    GetRemoteAbilityInfosPartialCallbackInfo *asyncCallbackInfo =
+        new (std::nothrow) GetRemoteAbilityInfosPartialCallbackInfo(env);
+    if (asyncCallbackInfo == nullptr) {
+        return nullptr;
+    }
+    std::unique_ptr<GetRemoteAbilityInfosPartialCallbackInfo> callbackPtr {asyncCallbackInfo};
+    if (!args.Init(ARGS_SIZE_ONE, ARGS_SIZE_FOUR)) {
+        APP_LOGE("param count invalid.");
+        BusinessError::ThrowTooFewParametersError(env, ERROR_PARAM_CHECK_ERROR);
+        return nullptr;
+    }
+    for (size_t i = 0; i < args.GetMaxArgc(); ++i) {
+        napi_valuetype valueType = napi_undefined;
+        napi_typeof(env, args[i], &valueType);
+        bool isArray = false;
+        if ((i == ARGS_POS_ZERO) && (!ParseElementNames(env, args[i], isArray, asyncCallbackInfo->elementNames) ||
+            !isArray)) {
+            BusinessError::ThrowParameterTypeError(env, ERROR_PARAM_CHECK_ERROR,
+                PARAMETER_ELEMENT_NAME, TYPE_ARRAY);
+            return nullptr;
+        } else if ((i != ARGS_POS_ZERO) && (valueType == napi_function)) {
+            NAPI_CALL(env, napi_create_reference(env, args[i], NAPI_RETURN_ONE, &asyncCallbackInfo->callback));
+            break;
+        } else if ((i == ARGS_POS_ONE) && !CommonFunc::ParseString(env, args[i], asyncCallbackInfo->locale)) {
+            BusinessError::ThrowParameterTypeError(env, ERROR_PARAM_CHECK_ERROR, PARAMETER_LOCALE, TYPE_STRING);
+            return nullptr;
+        } else if ((i == ARGS_POS_TWO) &&
+            !ParseRemoteAbilityInfoOptions(env, args[i], asyncCallbackInfo->options)) {
+            BusinessError::ThrowParameterTypeError(env, ERROR_PARAM_CHECK_ERROR, PARAMETER_OPTIONS, TYPE_OBJECT);
+            return nullptr;
+        }
+    }
+    if (asyncCallbackInfo->elementNames.size() > GET_REMOTE_ABILITY_INFO_MAX_SIZE) {
+        BusinessError::ThrowError(env, ERROR_PARAM_CHECK_ERROR, ELEMENT_NAMES_SIZE_ERROR);
+        return nullptr;
+    }
+    auto promise = CommonFunc::AsyncCallNativeMethod<GetRemoteAbilityInfosPartialCallbackInfo>(env,
+        asyncCallbackInfo, RESOURCE_NAME_GET_REMOTE_ABILITY_INFOS_PARTIAL, GetRemoteAbilityInfosPartialExec,
+        GetRemoteAbilityInfosPartialComplete);
+    callbackPtr.release();
+    APP_LOGD("GetRemoteAbilityInfosPartial end");
+    return promise;
+}
+
 void GetRemoteBundleVersionCodeExec(napi_env env, void *data)
 {
     GetRemoteBundleVersionCodeCallbackInfo *asyncCallbackInfo =
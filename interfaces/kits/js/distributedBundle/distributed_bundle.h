@@ -22,6 +22,8 @@
 #include "base_cb_info.h"
 #include "element_name.h"
 #include "remote_ability_info.h"
+#include "remote_ability_info_options.h"
+#include "remote_ability_info_result.h"
 
 namespace OHOS {
 namespace AppExecFwk {
@@ -33,6 +35,14 @@ struct GetRemoteAbilityInfoCallbackInfo : public BaseCallbackInfo {
     bool isArray = false;
 };
 
+struct GetRemoteAbilityInfosPartialCallbackInfo : public BaseCallbackInfo {
+    explicit GetRemoteAbilityInfosPartialCallbackInfo(napi_env napiEnv) : BaseCallbackInfo(napiEnv) {}
+    std::vector<ElementName> elementNames;
+    std::vector<RemoteAbilityInfoResult> remoteAbilityInfos;
+    std::string locale = "";
+    RemoteAbilityInfoOptions options;
+};
+
 struct GetRemoteBundleVersionCodeCallbackInfo : public BaseCallbackInfo {
     explicit GetRemoteBundleVersionCodeCallbackInfo(napi_env napiEnv) : BaseCallbackInfo(napiEnv) {}
     std::string deviceId;
@@ -41,6 +51,7 @@ struct GetRemoteBundleVersionCodeCallbackInfo : public BaseCallbackInfo {
 };
 
 napi_value GetRemoteAbilityInfo(napi_env env, napi_callback_info info);
+napi_value GetRemoteAbilityInfosPartial(napi_env env, napi_callback_info info);
 napi_value GetRemoteBundleVersionCode(napi_env env, napi_callback_info info);
 }  // namespace AppExecFwk
 }  // namespace OHOS
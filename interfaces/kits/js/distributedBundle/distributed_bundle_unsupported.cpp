@@ -33,6 +33,15 @@ napi_value GetRemoteAbilityInfo(napi_env env, napi_callback_info info)
     return nullptr;
 }
 
+napi_value GetRemoteAbilityInfosPartial(napi_env env, napi_callback_info info)
+{
+    APP_LOGE("SystemCapability.BundleManager.DistributedBundleFramework not supported.");
+    napi_value error = BusinessError::CreateCommonError(env, ERROR_SYSTEM_ABILITY_NOT_FOUND,
+        "getRemoteAbilityInfosPartial");
+    napi_throw(env, error);
+    return nullptr;
+}
+
 napi_value GetRemoteBundleVersionCode(napi_env env, napi_callback_info info)
 {
     APP_LOGE("SystemCapability.BundleManager.DistributedBundleFramework not supported.");
@@ -35,7 +35,16 @@ int32_t DistributedHelper::InnerGetRemoteAbilityInfo(const std::vector<ElementNa
         return ERROR_PARAM_CHECK_ERROR;
     }
     int32_t result;
-    if (isArray) {
+    if (isArray && elementNames.size() > GET_REMOTE_ABILITY_INFO_CHUNK_SIZE) {
+        std::vector<RemoteAbilityInfoResult> results;
+        result = InnerGetRemoteAbilityInfosChunked(elementNames, locale, RemoteAbilityInfoOptions(), true, results);
+        for (auto &remoteAbilityInfo : results) {
+            if (result == 0 && remoteAbilityInfo.resultCode != 0) {
+                result = remoteAbilityInfo.resultCode;
+            }
+            remoteAbilityInfos.emplace_back(std::move(remoteAbilityInfo.remoteAbilityInfo));
+        }
+    } else if (isArray) {
         result = DistributedBundleMgrClient::GetInstance()->GetRemoteAbilityInfos(
             elementNames, locale, remoteAbilityInfos);
     } else {
@@ -50,6 +59,47 @@ int32_t DistributedHelper::InnerGetRemoteAbilityInfo(const std::vector<ElementNa
     return CommonFunc::ConvertErrCode(result);
 }
 
+int32_t DistributedHelper::InnerGetRemoteAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+    const std::string &locale, const RemoteAbilityInfoOptions &options,
+    std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+{
+    if (elementNames.size() == 0) {
+        APP_LOGE("InnerGetRemoteAbilityInfosPartial elementNames is empty");
+        return ERROR_PARAM_CHECK_ERROR;
+    }
+    int32_t result;
+    if (elementNames.size() > GET_REMOTE_ABILITY_INFO_CHUNK_SIZE) {
+        result = InnerGetRemoteAbilityInfosChunked(elementNames, locale, options, false, remoteAbilityInfos);
+    } else {
+        result = DistributedBundleMgrClient::GetInstance()->GetRemoteAbilityInfosPartial(
+            elementNames, locale, options, remoteAbilityInfos);
+    }
+    if (result != 0) {
+        APP_LOGE("InnerGetRemoteAbilityInfosPartial failed");
+        return CommonFunc::ConvertErrCode(result);
+    }
+    for (auto &remoteAbilityInfo : remoteAbilityInfos) {
+        remoteAbilityInfo.resultCode = CommonFunc::ConvertErrCode(remoteAbilityInfo.resultCode);
+    }
+    return CommonFunc::ConvertErrCode(result);
+}
+
+int32_t DistributedHelper::InnerGetRemoteAbilityInfosChunked(const std::vector<ElementName> &elementNames,
+    const std::string &locale, const RemoteAbilityInfoOptions &options, bool stopOnError,
+    std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+{
+    return DistributedBundleMgrClient::GetInstance()->GetRemoteAbilityInfosChunked(elementNames, locale, options,
+        [stopOnError, &remoteAbilityInfos](std::vector<RemoteAbilityInfoResult> &chunk) {
+            bool hasError = false;
+            for (auto &remoteAbilityInfo : chunk) {
+                hasError = hasError || remoteAbilityInfo.resultCode != 0;
+                remoteAbilityInfos.emplace_back(std::move(remoteAbilityInfo));
+            }
+            // the remaining chunks are not queried once the whole query is known to fail
+            return !(stopOnError && hasError);
+        });
+}
+
 int32_t DistributedHelper::InnerGetRemoteBundleVersionCode(const std::string &deviceId, const std::string &bundleName,
     uint32_t &versionCode)
 {
@@ -18,15 +18,22 @@
 
 #include "element_name.h"
 #include "remote_ability_info.h"
+#include "remote_ability_info_options.h"
+#include "remote_ability_info_result.h"
 
 namespace OHOS {
 namespace AppExecFwk {
 namespace {
-constexpr int32_t GET_REMOTE_ABILITY_INFO_MAX_SIZE = 10;
+constexpr int32_t GET_REMOTE_ABILITY_INFO_MAX_SIZE = 512;
+// up to this many elements are answered with one request, larger queries are answered chunk by chunk
+constexpr int32_t GET_REMOTE_ABILITY_INFO_CHUNK_SIZE = 10;
+constexpr const char* ELEMENT_NAMES_SIZE_ERROR = "BusinessError 401: The number of ElementNames is greater than 512";
 constexpr const char* RESOURCE_NAME_GET_REMOTE_ABILITY_INFO = "GetRemoteAbilityInfo";
+constexpr const char* RESOURCE_NAME_GET_REMOTE_ABILITY_INFOS_PARTIAL = "GetRemoteAbilityInfosPartial";
 constexpr const char* RESOURCE_NAME_GET_REMOTE_BUNDLE_VERSION_CODE = "GetRemoteBundleVersionCode";
 constexpr const char* PARAMETER_ELEMENT_NAME = "elementName";
 constexpr const char* PARAMETER_LOCALE = "locale";
+constexpr const char* PARAMETER_OPTIONS = "options";
 constexpr const char* PARAMETER_DEVICE_ID = "deviceId";
 constexpr const char* PARAMETER_BUNDLE_NAME = "bundleName";
 }
@@ -34,6 +41,12 @@ class DistributedHelper {
 public:
     static int32_t InnerGetRemoteAbilityInfo(const std::vector<ElementName> &elementNames, const std::string &locale,
         bool isArray, std::vector<RemoteAbilityInfo> &remoteAbilityInfos);
+    static int32_t InnerGetRemoteAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+        const std::string &locale, const RemoteAbilityInfoOptions &options,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos);
+    static int32_t InnerGetRemoteAbilityInfosChunked(const std::vector<ElementName> &elementNames,
+        const std::string &locale, const RemoteAbilityInfoOptions &options, bool stopOnError,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos);
     static int32_t InnerGetRemoteBundleVersionCode(const std::string &deviceId, const std::string &bundleName,
         uint32_t &versionCode);
 };
@@ -21,21 +21,37 @@
 #include "distributed_bundle.h"
 #include "napi/native_api.h"
 #include "napi/native_node_api.h"
+#include "remote_ability_info_options.h"
 
 namespace OHOS {
 namespace AppExecFwk {
+static void CreateRemoteAbilityInfoFieldObject(napi_env env, napi_value value)
+{
+    napi_value nLabel;
+    NAPI_CALL_RETURN_VOID(env, napi_create_uint32(env, REMOTE_ABILITY_INFO_FIELD_LABEL, &nLabel));
+    NAPI_CALL_RETURN_VOID(env, napi_set_named_property(env, value, "LABEL", nLabel));
+    napi_value nIcon;
+    NAPI_CALL_RETURN_VOID(env, napi_create_uint32(env, REMOTE_ABILITY_INFO_FIELD_ICON, &nIcon));
+    NAPI_CALL_RETURN_VOID(env, napi_set_named_property(env, value, "ICON", nIcon));
+}
+
 EXTERN_C_START
 /*
  * function for module exports
  */
 static napi_value Init(napi_env env, napi_value exports)
 {
+    napi_value remoteAbilityInfoField = nullptr;
+    NAPI_CALL(env, napi_create_object(env, &remoteAbilityInfoField));
+    CreateRemoteAbilityInfoFieldObject(env, remoteAbilityInfoField);
     /*
      * Propertise define
      */
     napi_property_descriptor desc[] = {
         DECLARE_NAPI_FUNCTION("getRemoteAbilityInfo", GetRemoteAbilityInfo),
+        DECLARE_NAPI_FUNCTION("getRemoteAbilityInfosPartial", GetRemoteAbilityInfosPartial),
         DECLARE_NAPI_FUNCTION("getRemoteBundleVersionCode", GetRemoteBundleVersionCode),
+        DECLARE_NAPI_PROPERTY("RemoteAbilityInfoField", remoteAbilityInfoField),
     };
     NAPI_CALL(env, napi_define_properties(env, exports, sizeof(desc) / sizeof(desc[0]), desc));
     APP_LOGI("distributedBundle -----Init end------");
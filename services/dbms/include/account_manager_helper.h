@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_ACCOUNT_MANAGER_HELPER_H
 #define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_ACCOUNT_MANAGER_HELPER_H
 
+#include <atomic>
 #include <string>
 #ifdef ACCOUNT_ENABLE
 #include "accesstoken_kit.h"
@@ -27,10 +28,26 @@ namespace OHOS {
 namespace AppExecFwk {
 class AccountManagerHelper {
 public:
+    /**
+     * @brief get the foreground user, which is queried only until the first user switch is received.
+     * @return Returns the foreground user id; returns INVALID_USERID if it is unknown.
+     */
     static int32_t GetCurrentActiveUserId();
+
+    /**
+     * @brief keep the foreground user reported by a user switch.
+     * @param userId Indicates the foreground user id, INVALID_USERID to query it again on the next get.
+     */
+    static void SetCurrentActiveUserId(int32_t userId);
 #ifdef ACCOUNT_ENABLE
     static bool GetOsAccountData(AccountSA::OhosAccountInfo& osAccountInfo);
 #endif
+
+private:
+    static int32_t QueryCurrentActiveUserId();
+    static int32_t InitCurrentActiveUserId(int32_t queriedUserId);
+
+    static std::atomic<int32_t> currentActiveUserId_;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
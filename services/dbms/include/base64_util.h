@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_BASE64_UTIL_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_BASE64_UTIL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace OHOS {
+namespace AppExecFwk {
+enum class Base64EncoderType {
+    SCALAR = 0,
+    SSSE3,
+    AVX2,
+    NEON,
+};
+
+class Base64Util {
+public:
+    /**
+     * @brief get the padded base64 length of srcLen bytes, not including the terminator.
+     */
+    static size_t GetEncodedLength(size_t srcLen);
+
+    /**
+     * @brief encode src to standard padded base64, the fastest encoder of the cpu is chosen on first use.
+     * @param dst Indicates the output buffer, at least GetEncodedLength(srcLen) bytes, no terminator is written.
+     * @return Returns the number of chars written to dst.
+     */
+    static size_t Encode(const uint8_t *src, size_t srcLen, char *dst);
+
+    /**
+     * @brief encode with the given encoder, falls back to scalar if the cpu does not support it.
+     */
+    static size_t Encode(const uint8_t *src, size_t srcLen, char *dst, Base64EncoderType type);
+
+    /**
+     * @brief decode standard padded base64, only used on the fallback paths so it is scalar.
+     * @return Returns false if src is not well formed base64.
+     */
+    static bool Decode(const char *src, size_t srcLen, std::vector<uint8_t> &dst);
+
+    static Base64EncoderType GetEncoderType();
+    static bool IsEncoderSupported(Base64EncoderType type);
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_BASE64_UTIL_H
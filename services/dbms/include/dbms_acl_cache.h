@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_ACL_CACHE_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_ACL_CACHE_H
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "distributed_bms_acl_info.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+class DbmsAclCache {
+public:
+    DbmsAclCache(size_t capacity, std::chrono::milliseconds ttl);
+    ~DbmsAclCache() = default;
+    static std::shared_ptr<DbmsAclCache> GetInstance();
+
+    /**
+     * @brief get the acl decision of a remote caller made within the ttl.
+     * @param networkId Indicates the network id of the calling device.
+     * @param info Indicates the acl info sent by the caller.
+     * @param allowed Indicates whether the caller is allowed.
+     * @return Returns true if a fresh decision is cached; returns false otherwise.
+     */
+    bool Get(const std::string &networkId, const DistributedBmsAclInfo &info, bool &allowed);
+
+    /**
+     * @brief cache the acl decision of a remote caller, the oldest decision is dropped when full.
+     * @param networkId Indicates the network id of the calling device.
+     * @param info Indicates the acl info sent by the caller.
+     * @param allowed Indicates whether the caller is allowed.
+     */
+    void Put(const std::string &networkId, const DistributedBmsAclInfo &info, bool allowed);
+
+    /**
+     * @brief drop the decisions of a device, called when the device goes online, offline or changes.
+     * @param networkId Indicates the network id of the device.
+     */
+    void Invalidate(const std::string &networkId);
+    void Clear();
+    size_t GetCount();
+
+private:
+    struct AclCacheEntry {
+        bool allowed = false;
+        std::chrono::steady_clock::time_point time;
+    };
+
+    static std::string KeyToString(const std::string &networkId, const DistributedBmsAclInfo &info);
+
+    static std::mutex instanceMutex_;
+    static std::shared_ptr<DbmsAclCache> instance_;
+
+    std::mutex mutex_;
+    size_t capacity_ = 0;
+    std::chrono::milliseconds ttl_;
+    // ordered by key, the network id prefix of a key lets a device be dropped with one range erase
+    std::map<std::string, AclCacheEntry> entries_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_ACL_CACHE_H
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_ACL_INFO_CACHE_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_ACL_INFO_CACHE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "distributed_bms_acl_info.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+class DbmsAclInfoCache {
+public:
+    explicit DbmsAclInfoCache(size_t capacity);
+    ~DbmsAclInfoCache() = default;
+    static std::shared_ptr<DbmsAclInfoCache> GetInstance();
+
+    /**
+     * @brief get the acl info sent to remote devices on behalf of a local caller.
+     * @param uid Indicates the uid of the caller.
+     * @param userId Indicates the active user.
+     * @param info Indicates the acl info of the caller.
+     * @return Returns true if the acl info is cached; returns false otherwise.
+     */
+    bool Get(int32_t uid, int32_t userId, DistributedBmsAclInfo &info);
+
+    /**
+     * @brief cache the acl info of a local caller, an arbitrary entry is dropped when full.
+     * @param uid Indicates the uid of the caller.
+     * @param userId Indicates the active user.
+     * @param info Indicates the acl info of the caller.
+     */
+    void Put(int32_t uid, int32_t userId, const DistributedBmsAclInfo &info);
+
+    /**
+     * @brief drop the acl info of the callers of a bundle, called when the bundle is removed.
+     * @param bundleName Indicates the bundle name.
+     */
+    void Invalidate(const std::string &bundleName);
+    void Clear();
+    size_t GetCount();
+
+private:
+    static std::mutex instanceMutex_;
+    static std::shared_ptr<DbmsAclInfoCache> instance_;
+
+    std::mutex mutex_;
+    size_t capacity_ = 0;
+    std::map<std::pair<int32_t, int32_t>, DistributedBmsAclInfo> infos_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_ACL_INFO_CACHE_H
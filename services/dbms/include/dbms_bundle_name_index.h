@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_BUNDLE_NAME_INDEX_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_BUNDLE_NAME_INDEX_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * Bundle names of the devices in the distributed store by access token id, kept up to date by the store change
+ * notifications so that a lookup neither scans the store nor parses any value.
+ */
+class DbmsBundleNameIndex {
+public:
+    // bundle name and access token id of every bundle of a device
+    using Rows = std::vector<std::pair<std::string, uint32_t>>;
+
+    DbmsBundleNameIndex() = default;
+    ~DbmsBundleNameIndex() = default;
+    static std::shared_ptr<DbmsBundleNameIndex> GetInstance();
+
+    /**
+     * @brief get the bundle name of an access token id of a device.
+     * @param udid Indicates the udid of the device.
+     * @param accessTokenId Indicates the access token id.
+     * @param bundleName Indicates the bundle name.
+     * @return Returns true if the device has a bundle of the access token id; returns false otherwise.
+     */
+    bool Get(const std::string &udid, uint32_t accessTokenId, std::string &bundleName);
+
+    /**
+     * @brief whether every bundle of the device is indexed, otherwise it has to be loaded first.
+     */
+    bool IsLoaded(const std::string &udid);
+
+    /**
+     * @brief index every bundle of the device. Changes wait until the rows are fetched and indexed,
+     * so none of them is lost in between.
+     * @param udid Indicates the udid of the device.
+     * @param fetch Indicates how to read the rows of the device from the store.
+     * @return Returns true if the rows are fetched and indexed; returns false otherwise.
+     */
+    bool Load(const std::string &udid, const std::function<bool(Rows &)> &fetch);
+
+    /**
+     * @brief index a bundle inserted or updated in the store, the previous access token id of it is dropped.
+     */
+    void Put(const std::string &udid, const std::string &bundleName, uint32_t accessTokenId);
+
+    /**
+     * @brief drop a bundle deleted from the store.
+     */
+    void Remove(const std::string &udid, const std::string &bundleName);
+
+    /**
+     * @brief drop every bundle of the device, it is loaded again on the next lookup.
+     */
+    void Invalidate(const std::string &udid);
+
+    /**
+     * @brief remember the network id of a device, so the device can be dropped when it goes offline.
+     */
+    void BindNetworkId(const std::string &networkId, const std::string &udid);
+
+    /**
+     * @brief drop every bundle of the device of the network id, called when the device goes offline.
+     */
+    void InvalidateByNetworkId(const std::string &networkId);
+    void Clear();
+
+private:
+    struct DeviceIndex {
+        bool loaded = false;
+        std::unordered_map<uint32_t, std::string> bundleNames;
+        std::unordered_map<std::string, uint32_t> accessTokenIds;
+    };
+
+    static void PutLocked(DeviceIndex &device, const std::string &bundleName, uint32_t accessTokenId);
+
+    static std::mutex instanceMutex_;
+    static std::shared_ptr<DbmsBundleNameIndex> instance_;
+
+    // serializes the changes, a lookup only takes mutex_
+    std::mutex updateMutex_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, DeviceIndex> devices_;
+    // udid of each network id bound by a lookup
+    std::unordered_map<std::string, std::string> udids_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_BUNDLE_NAME_INDEX_H
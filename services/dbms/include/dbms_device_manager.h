@@ -16,7 +16,9 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_BUNDLEMGR_INCLUDE_BMS_DEVICE_MANAGER_H
 #define FOUNDATION_APPEXECFWK_SERVICES_BUNDLEMGR_INCLUDE_BMS_DEVICE_MANAGER_H
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "device_manager_callback.h"
@@ -31,18 +33,39 @@ public:
     DbmsDeviceManager();
     int32_t GetUdidByNetworkId(const std::string &netWorkId, std::string &udid);
     int32_t GetUuidByNetworkId(const std::string &netWorkId, std::string &uuid);
+    /**
+     * @brief get the local device info, which is queried once and kept until the device manager reports a change.
+     * @param dmDeviceInfo Indicates the local device info.
+     * @return Returns true if the local device info is got; returns false otherwise.
+     */
     bool GetLocalDevice(DistributedHardware::DmDeviceInfo& dmDeviceInfo);
     bool CheckAclData(DistributedBmsAclInfo info);
 
 private:
     bool InitDeviceManager();
+    static void ResetLocalDevice();
+    static void OnDeviceInfoChanged(const DistributedHardware::DmDeviceInfo &deviceInfo);
     std::shared_ptr<DistributedHardware::DmInitCallback> initCallback_;
+    std::shared_ptr<DistributedHardware::DeviceStateCallback> stateCallback_;
     mutable std::mutex isInitMutex_;
-    bool isInit_ = false;
+    std::atomic<bool> isInit_ {false};
+
+    // the local device is the same for every instance, readers load it without a lock
+    static std::mutex localDeviceMutex_;
+    static uint64_t localDeviceVersion_;
+    static std::shared_ptr<const DistributedHardware::DmDeviceInfo> localDevice_;
 
 class DeviceInitCallBack : public DistributedHardware::DmInitCallback {
     void OnRemoteDied() override;
 };
+
+// a trust relationship may change whenever the state of a device does, so its acl decisions are dropped
+class DeviceStateCallBack : public DistributedHardware::DeviceStateCallback {
+    void OnDeviceOnline(const DistributedHardware::DmDeviceInfo &deviceInfo) override;
+    void OnDeviceOffline(const DistributedHardware::DmDeviceInfo &deviceInfo) override;
+    void OnDeviceChanged(const DistributedHardware::DmDeviceInfo &deviceInfo) override;
+    void OnDeviceReady(const DistributedHardware::DmDeviceInfo &deviceInfo) override;
+};
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_ICON_CACHE_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_ICON_CACHE_H
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OHOS {
+namespace AppExecFwk {
+struct IconData {
+    std::string type;
+    // shared by the cache, the icon store and the replies instead of a copy each
+    std::shared_ptr<const uint8_t> data;
+    size_t size = 0;
+    // content hash of type and data, requesters send it back to skip an unchanged icon
+    std::string hash;
+
+    /**
+     * @brief hold a copy of the bytes.
+     */
+    void Assign(const uint8_t *bytes, size_t length);
+};
+
+struct IconCacheKey {
+    std::string bundleName;
+    std::string moduleName;
+    std::string abilityName;
+    int32_t userId = 0;
+    uint32_t versionCode = 0;
+    uint32_t iconId = 0;
+    // 0 for the default size
+    int32_t maxIconEdge = 0;
+};
+
+class DbmsIconCache {
+public:
+    explicit DbmsIconCache(size_t capacity);
+    ~DbmsIconCache() = default;
+    static std::shared_ptr<DbmsIconCache> GetInstance();
+
+    /**
+     * @brief get the cached image of an ability icon and move it to the front.
+     * @param key Indicates the icon key.
+     * @param icon Indicates the image type and the compressed image bytes.
+     * @return Returns true if the icon is cached; returns false otherwise.
+     */
+    bool Get(const IconCacheKey &key, std::shared_ptr<const IconData> &icon);
+
+    /**
+     * @brief cache the image of an ability icon, least recently used icons are evicted to fit the capacity.
+     * @param key Indicates the icon key.
+     * @param icon Indicates the image type and the compressed image bytes.
+     */
+    void Put(const IconCacheKey &key, const std::shared_ptr<const IconData> &icon);
+
+    /**
+     * @brief drop all icons of the bundle, called when the bundle is installed, updated or removed.
+     * @param bundleName Indicates the bundle name.
+     */
+    void Invalidate(const std::string &bundleName);
+    void Clear();
+    size_t GetSize();
+
+    /**
+     * @brief compute the content hash of an icon, which is 64 bit FNV-1a of the type and data plus the data size.
+     */
+    static std::string ComputeHash(const IconData &icon);
+
+private:
+    struct IconCacheEntry {
+        std::string key;
+        std::string bundleName;
+        std::shared_ptr<const IconData> icon;
+        size_t size = 0;
+    };
+
+    static std::string KeyToString(const IconCacheKey &key);
+    void EraseLocked(std::list<IconCacheEntry>::iterator it);
+
+    static std::mutex instanceMutex_;
+    static std::shared_ptr<DbmsIconCache> instance_;
+
+    std::mutex mutex_;
+    size_t capacity_ = 0;
+    size_t size_ = 0;
+    std::list<IconCacheEntry> entries_;
+    std::unordered_map<std::string, std::list<IconCacheEntry>::iterator> index_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_ICON_CACHE_H
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_ICON_STORE_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_ICON_STORE_H
+
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dbms_icon_cache.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+struct PrecomputedAbilityInfo {
+    std::string moduleName;
+    std::string abilityName;
+    uint32_t labelId = 0;
+    // the locale the label was resolved with
+    std::string locale;
+    std::string label;
+    std::shared_ptr<const IconData> icon;
+};
+
+/**
+ * Persistent store of the labels and compressed icons of the installed abilities. It is filled in the
+ * background when a bundle is installed or updated, so remote queries need not decode and compress images.
+ */
+class DbmsIconStore {
+public:
+    DbmsIconStore(const std::string &storeDir, size_t capacity);
+    ~DbmsIconStore() = default;
+    static std::shared_ptr<DbmsIconStore> GetInstance();
+
+    /**
+     * @brief get the precomputed info of an ability. The bundle is loaded from disk unless it is among the
+     * recently used bundles kept in memory.
+     * @param moduleName Indicates the module name, empty matches any module.
+     * @return Returns true if the ability is in the store; returns false otherwise.
+     */
+    bool Get(const std::string &bundleName, const std::string &moduleName, const std::string &abilityName,
+        int32_t userId, PrecomputedAbilityInfo &info);
+
+    /**
+     * @brief replace all precomputed infos of the bundle and write them to disk.
+     * @return Returns true if the infos are written; returns false otherwise.
+     */
+    bool Save(const std::string &bundleName, int32_t userId, const std::vector<PrecomputedAbilityInfo> &infos);
+
+    /**
+     * @brief drop the precomputed infos of the bundle, called when the bundle is removed.
+     */
+    void Remove(const std::string &bundleName, int32_t userId);
+
+    /**
+     * @brief drop the stale infos of the bundle and precompute them again on the background thread.
+     */
+    void Schedule(const std::string &bundleName, int32_t userId);
+
+    /**
+     * @brief precompute the installed bundles of the user that are not in the store yet, such as the bundles
+     * installed before the store existed.
+     */
+    void Backfill(int32_t userId);
+
+    /**
+     * @brief drop the bundles kept in memory, the files on disk are kept.
+     */
+    void Clear();
+    size_t GetSize();
+
+private:
+    struct StoreCacheEntry {
+        std::string path;
+        // an empty vector means the bundle is not stored
+        std::vector<PrecomputedAbilityInfo> infos;
+        size_t size = 0;
+    };
+
+    static size_t GetEntrySize(const std::string &path, const std::vector<PrecomputedAbilityInfo> &infos);
+    std::string GetFilePath(const std::string &bundleName, int32_t userId) const;
+    void PutLocked(const std::string &path, std::vector<PrecomputedAbilityInfo> infos);
+    void EraseLocked(std::list<StoreCacheEntry>::iterator it);
+    void Enqueue(const std::string &bundleName, int32_t userId);
+    bool LoadFromFile(const std::string &path, std::vector<PrecomputedAbilityInfo> &infos) const;
+    bool WriteToFile(const std::string &path, const std::vector<PrecomputedAbilityInfo> &infos) const;
+    void RunPendingTasks();
+
+    static std::mutex instanceMutex_;
+    static std::shared_ptr<DbmsIconStore> instance_;
+
+    std::string storeDir_;
+    std::mutex mutex_;
+    // recently used bundles keyed by file path, least recently used bundles are evicted to fit the capacity
+    size_t capacity_ = 0;
+    size_t size_ = 0;
+    std::list<StoreCacheEntry> entries_;
+    std::unordered_map<std::string, std::list<StoreCacheEntry>::iterator> index_;
+
+    std::mutex taskMutex_;
+    bool workerRunning_ = false;
+    std::deque<std::pair<std::string, int32_t>> tasks_;
+    std::set<std::pair<std::string, int32_t>> pendingTasks_;
+    std::pair<std::string, int32_t> runningTask_;
+    bool runningTaskCancelled_ = false;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_ICON_STORE_H
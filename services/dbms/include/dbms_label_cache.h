@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_LABEL_CACHE_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_LABEL_CACHE_H
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace OHOS {
+namespace AppExecFwk {
+struct LabelCacheKey {
+    std::string bundleName;
+    std::string moduleName;
+    uint32_t labelId = 0;
+    // the locale the label is resolved with, never empty
+    std::string localeInfo;
+    int32_t userId = 0;
+};
+
+class DbmsLabelCache {
+public:
+    explicit DbmsLabelCache(size_t capacity);
+    ~DbmsLabelCache() = default;
+    static std::shared_ptr<DbmsLabelCache> GetInstance();
+
+    /**
+     * @brief get the cached label and move it to the front, the hit and miss counters are updated.
+     * @param key Indicates the label key.
+     * @param label Indicates the localized label.
+     * @return Returns true if the label is cached; returns false otherwise.
+     */
+    bool Get(const LabelCacheKey &key, std::string &label);
+
+    /**
+     * @brief cache a label, least recently used labels are evicted to fit the capacity.
+     * @param key Indicates the label key.
+     * @param label Indicates the localized label, an empty label is not cached.
+     */
+    void Put(const LabelCacheKey &key, const std::string &label);
+
+    /**
+     * @brief drop all labels of the bundle, called when the bundle is installed, updated or removed.
+     * @param bundleName Indicates the bundle name.
+     */
+    void Invalidate(const std::string &bundleName);
+
+    /**
+     * @brief drop all labels, called when the foreground user switches.
+     */
+    void Clear();
+    size_t GetCount();
+    uint64_t GetHitCount() const;
+    uint64_t GetMissCount() const;
+
+private:
+    struct LabelCacheEntry {
+        std::string key;
+        std::string bundleName;
+        std::string label;
+    };
+
+    static std::string KeyToString(const LabelCacheKey &key);
+    void EraseLocked(std::list<LabelCacheEntry>::iterator it);
+
+    static std::mutex instanceMutex_;
+    static std::shared_ptr<DbmsLabelCache> instance_;
+
+    size_t capacity_ = 0;
+    std::mutex mutex_;
+    std::list<LabelCacheEntry> entries_;
+    std::unordered_map<std::string, std::list<LabelCacheEntry>::iterator> index_;
+    std::atomic<uint64_t> hitCount_ {0};
+    std::atomic<uint64_t> missCount_ {0};
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_LABEL_CACHE_H
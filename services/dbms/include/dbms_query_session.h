@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_QUERY_SESSION_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_QUERY_SESSION_H
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "distributed_bms_acl_info.h"
+#include "distributed_bms_interface.h"
+#include "element_name.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @brief a remote ability query answered chunk by chunk, the acl info is built once for all chunks.
+ */
+struct DbmsQuerySession {
+    uint32_t callerTokenId = 0;
+    std::vector<ElementName> elementNames;
+    std::string localeInfo;
+    RemoteAbilityInfoOptions options;
+    size_t nextIndex = 0;
+    DistributedBmsAclInfo aclInfo;
+    bool aclInfoBuilt = false;
+};
+
+class DbmsQuerySessions {
+public:
+    DbmsQuerySessions(size_t capacity, std::chrono::milliseconds timeout);
+    ~DbmsQuerySessions() = default;
+    static std::shared_ptr<DbmsQuerySessions> GetInstance();
+
+    /**
+     * @brief keep a session until its next chunk is requested, the oldest session is dropped when full.
+     * @param token Indicates the token of the session, 0 to allocate a new one.
+     * @param session Indicates the session.
+     * @return Returns the continuation token of the session.
+     */
+    uint64_t Put(uint64_t token, const std::shared_ptr<DbmsQuerySession> &session);
+
+    /**
+     * @brief take a session out to answer its next chunk, a session only serves the caller which opened it.
+     * @param token Indicates the continuation token.
+     * @param callerTokenId Indicates the access token id of the caller.
+     * @return Returns the session; returns nullptr if it is unknown, expired or opened by another caller.
+     */
+    std::shared_ptr<DbmsQuerySession> Take(uint64_t token, uint32_t callerTokenId);
+    void Clear();
+    size_t GetCount();
+
+private:
+    struct SessionEntry {
+        std::shared_ptr<DbmsQuerySession> session;
+        std::chrono::steady_clock::time_point lastAccess;
+    };
+
+    void RemoveExpiredLocked(std::chrono::steady_clock::time_point now);
+
+    static std::mutex instanceMutex_;
+    static std::shared_ptr<DbmsQuerySessions> instance_;
+
+    std::mutex mutex_;
+    size_t capacity_ = 0;
+    std::chrono::milliseconds timeout_;
+    uint64_t nextToken_ = 1;
+    std::map<uint64_t, SessionEntry> sessions_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_QUERY_SESSION_H
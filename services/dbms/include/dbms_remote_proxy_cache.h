@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_REMOTE_PROXY_CACHE_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_REMOTE_PROXY_CACHE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "distributed_bms_interface.h"
+#include "iremote_object.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+class DbmsRemoteProxyCache {
+public:
+    DbmsRemoteProxyCache() = default;
+    ~DbmsRemoteProxyCache() = default;
+    static std::shared_ptr<DbmsRemoteProxyCache> GetInstance();
+
+    /**
+     * @brief get the d-bms proxy of a remote device, samgr is only asked when no live proxy is cached.
+     * @param deviceId Indicates the network id of the remote device.
+     * @return Returns the proxy; returns nullptr if the remote d-bms is not running.
+     */
+    sptr<IDistributedBms> Get(const std::string &deviceId);
+
+    /**
+     * @brief tell whether a live proxy of the remote device is cached, without any ipc.
+     * @param deviceId Indicates the network id of the remote device.
+     * @return Returns true if the remote d-bms is known to be running; returns false otherwise.
+     */
+    bool IsAlive(const std::string &deviceId);
+
+    /**
+     * @brief drop the proxy of a device, called when the device goes offline.
+     * @param deviceId Indicates the network id of the device.
+     */
+    void Remove(const std::string &deviceId);
+    void Clear();
+    size_t GetCount();
+
+private:
+    class RemoteDeathRecipient : public IRemoteObject::DeathRecipient {
+    public:
+        explicit RemoteDeathRecipient(const std::string &deviceId) : deviceId_(deviceId) {}
+        void OnRemoteDied(const wptr<IRemoteObject> &remote) override;
+
+    private:
+        std::string deviceId_;
+    };
+
+    struct ProxyEntry {
+        sptr<IDistributedBms> proxy;
+        sptr<IRemoteObject::DeathRecipient> recipient;
+    };
+
+    sptr<IDistributedBms> Put(const std::string &deviceId, const sptr<IDistributedBms> &proxy);
+    // only the entry of the dead object is dropped, a proxy got after the death is kept
+    void RemoveDead(const std::string &deviceId, const sptr<IRemoteObject> &remote);
+    static void RemoveRecipient(const ProxyEntry &entry);
+
+    static std::mutex instanceMutex_;
+    static std::shared_ptr<DbmsRemoteProxyCache> instance_;
+
+    std::mutex mutex_;
+    std::map<std::string, ProxyEntry> proxies_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_REMOTE_PROXY_CACHE_H
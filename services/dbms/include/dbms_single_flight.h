@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_SINGLE_FLIGHT_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_SINGLE_FLIGHT_H
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "distributed_bms_deadline.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * Lets concurrent callers asking the same query wait on one in-flight call and share its result.
+ */
+template<typename T>
+class DbmsSingleFlight {
+public:
+    /**
+     * @brief run query, or wait for the query of the same key already in flight and share its result.
+     * @param key Indicates the key, callers of the same key get the same result.
+     * @param query Indicates the query, only run by the first caller, it must not throw.
+     * @param result Indicates the result of the query.
+     * @return Returns the result code of the query; returns ERR_DBMS_DEADLINE_EXCEEDED if the deadline of the
+     * calling thread passes while waiting.
+     */
+    int32_t Do(const std::string &key, const std::function<int32_t(T &)> &query, T &result)
+    {
+        std::shared_ptr<Call> call;
+        bool isOwner = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto item = calls_.find(key);
+            if (item != calls_.end()) {
+                call = item->second;
+                call->waiterNum++;
+            } else {
+                call = std::make_shared<Call>();
+                calls_.emplace(key, call);
+                isOwner = true;
+            }
+        }
+        if (!isOwner) {
+            return Wait(call, result);
+        }
+        T value;
+        int32_t resultCode = query(value);
+        size_t waiterNum = 0;
+        {
+            // callers arriving from now on start a new query instead of sharing a finished one
+            std::lock_guard<std::mutex> lock(mutex_);
+            calls_.erase(key);
+            waiterNum = call->waiterNum;
+        }
+        {
+            std::lock_guard<std::mutex> lock(call->mutex);
+            call->resultCode = resultCode;
+            if (waiterNum > 0) {
+                call->result = value;
+            }
+            call->done = true;
+        }
+        call->condition.notify_all();
+        result = std::move(value);
+        return resultCode;
+    }
+
+    size_t GetCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return calls_.size();
+    }
+
+private:
+    struct Call {
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool done = false;
+        size_t waiterNum = 0;
+        int32_t resultCode = 0;
+        T result;
+    };
+
+    int32_t Wait(const std::shared_ptr<Call> &call, T &result)
+    {
+        std::unique_lock<std::mutex> lock(call->mutex);
+        auto deadline = DistributedBmsDeadline::GetDeadline();
+        if (deadline == std::chrono::steady_clock::time_point::max()) {
+            call->condition.wait(lock, [&call] { return call->done; });
+        } else if (!call->condition.wait_until(lock, deadline, [&call] { return call->done; })) {
+            // a waiter keeps to its own deadline, the owner goes on for the callers still waiting
+            return ERR_DBMS_DEADLINE_EXCEEDED;
+        }
+        result = call->result;
+        return call->resultCode;
+    }
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<Call>> calls_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_SINGLE_FLIGHT_H
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_TASK_POOL_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_TASK_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * Bounded pool of worker threads for fanning out the elements of a batch query and for the asynchronous queries.
+ */
+class DbmsTaskPool {
+public:
+    explicit DbmsTaskPool(size_t threadNum, size_t maxPostedNum = std::numeric_limits<size_t>::max());
+    ~DbmsTaskPool();
+    static std::shared_ptr<DbmsTaskPool> GetInstance();
+
+    /**
+     * @brief the pool of the asynchronous queries, which may wait on remote devices for long, so they neither
+     * take the workers of the batch queries nor queue up without bound.
+     */
+    static std::shared_ptr<DbmsTaskPool> GetAsyncInstance();
+
+    /**
+     * @brief run task for every index in [0, count) and wait until all of them finish.
+     * The calling thread takes part, so a busy pool only slows the batch down and never blocks it.
+     * @param count Indicates the number of indexes.
+     * @param task Indicates the task, it must not throw.
+     */
+    void ParallelFor(size_t count, const std::function<void(size_t)> &task);
+
+    /**
+     * @brief run task on a worker thread without waiting for it, for the queries answered through a callback.
+     * @param task Indicates the task, it must not throw.
+     * @return Returns true if the task is queued; returns false if too many posted tasks are waiting.
+     */
+    bool Post(std::function<void()> task);
+    size_t GetThreadNum() const;
+
+private:
+    void StartLocked();
+    void WorkerLoop();
+
+    static std::mutex instanceMutex_;
+    static std::shared_ptr<DbmsTaskPool> instance_;
+    static std::shared_ptr<DbmsTaskPool> asyncInstance_;
+
+    size_t threadNum_ = 0;
+    size_t maxPostedNum_ = 0;
+    // posted tasks not started yet
+    size_t postedNum_ = 0;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stopped_ = false;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> workers_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DBMS_TASK_POOL_H
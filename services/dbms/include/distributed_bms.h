@@ -21,6 +21,10 @@
 #include "bundle_info.h"
 #include "bundle_mgr_interface.h"
 #include "dbms_device_manager.h"
+#include "dbms_icon_cache.h"
+#include "dbms_icon_store.h"
+#include "dbms_query_session.h"
+#include "dbms_single_flight.h"
 #include "distributed_bms_host.h"
 #include "distributed_monitor.h"
 #include "if_system_ability_manager.h"
@@ -30,6 +34,24 @@
 #include "system_ability.h"
 namespace OHOS {
 namespace AppExecFwk {
+/**
+ * The label and icon resolved for one element of a batch, result holds the error if it is not resolved.
+ */
+struct AbilityLabelAndIcon {
+    int32_t result = ERR_OK;
+    std::string label;
+    std::shared_ptr<const IconData> iconData;
+};
+
+/**
+ * The elements of a batch that belong to one remote device, indexes are their positions in the batch.
+ */
+struct RemoteDeviceGroup {
+    std::string deviceId;
+    std::vector<size_t> indexes;
+    std::vector<ElementName> elementNames;
+};
+
 class DistributedBms : public SystemAbility, public DistributedBmsHost {
     DECLARE_DELAYED_SINGLETON(DistributedBms);
     DECLARE_SYSTEM_ABILITY(DistributedBms);
@@ -112,6 +134,94 @@ public:
     int32_t GetAbilityInfos(const std::vector<ElementName> &elementNames, const std::string &localeInfo,
         std::vector<RemoteAbilityInfo> &remoteAbilityInfos, DistributedBmsAclInfo *info = nullptr) override;
 
+    /**
+     * @brief get remote ability infos with the icons as raw image bytes.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param remoteAbilityInfos Indicates the remote ability infos with binary icons.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    int32_t GetRemoteAbilityInfosWithBinaryIcon(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos) override;
+
+    /**
+     * @brief get ability infos with the icons as raw image bytes.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param remoteAbilityInfos Indicates the remote ability infos with binary icons.
+     * @param info Indicates the acl info.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    int32_t GetAbilityInfosWithBinaryIcon(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos,
+        DistributedBmsAclInfo *info = nullptr) override;
+
+    /**
+     * @brief get remote ability infos, the icons matching the given hashes are not sent again.
+     * @param elementNames Indicates the elementNames.
+     * @param iconHashes Indicates the hashes of the icons held by the caller, empty or one per elementName.
+     * @param localeInfo Indicates the localeInfo.
+     * @param remoteAbilityInfos Indicates the remote ability infos with the hashes of the icons.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    int32_t GetRemoteAbilityInfosIfModified(const std::vector<ElementName> &elementNames,
+        const std::vector<std::string> &iconHashes, const std::string &localeInfo,
+        std::vector<RemoteAbilityConditionalInfo> &remoteAbilityInfos) override;
+
+    /**
+     * @brief get ability infos, the icons matching the given hashes are not sent again.
+     * @param elementNames Indicates the elementNames.
+     * @param iconHashes Indicates the hashes of the icons held by the caller, empty or one per elementName.
+     * @param localeInfo Indicates the localeInfo.
+     * @param remoteAbilityInfos Indicates the remote ability infos with the hashes of the icons.
+     * @param info Indicates the acl info.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    int32_t GetAbilityInfosIfModified(const std::vector<ElementName> &elementNames,
+        const std::vector<std::string> &iconHashes, const std::string &localeInfo,
+        std::vector<RemoteAbilityConditionalInfo> &remoteAbilityInfos,
+        DistributedBmsAclInfo *info = nullptr) override;
+
+    /**
+     * @brief get remote ability infos, a failed element does not fail the batch.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param options Indicates the fields to return and the icon size.
+     * @param remoteAbilityInfos Indicates the remote ability infos with the result code of each element.
+     * @return Returns ERR_OK if every element has its result; returns the error of the whole batch otherwise.
+     */
+    int32_t GetRemoteAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos) override;
+
+    /**
+     * @brief get ability infos, a failed element does not fail the batch.
+     * @param elementNames Indicates the elementNames.
+     * @param localeInfo Indicates the localeInfo.
+     * @param options Indicates the fields to return and the icon size.
+     * @param remoteAbilityInfos Indicates the remote ability infos with the result code of each element.
+     * @param info Indicates the acl info.
+     * @return Returns ERR_OK if every element has its result; returns the error of the whole batch otherwise.
+     */
+    int32_t GetAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos,
+        DistributedBmsAclInfo *info = nullptr) override;
+
+    /**
+     * @brief get remote ability infos chunk by chunk, a failed element does not fail the batch.
+     * @param elementNames Indicates the elementNames, only read when a query is started.
+     * @param localeInfo Indicates the localeInfo, only read when a query is started.
+     * @param options Indicates the fields to return and the icon size, only read when a query is started.
+     * @param continuationToken Indicates 0 to start a query or the token of the next chunk, set to the token
+     * of the following chunk or to 0 when the last chunk is returned.
+     * @param remoteAbilityInfos Indicates the remote ability infos of the chunk with the result code of each element.
+     * @return Returns ERR_OK if every element of the chunk has its result; returns the error of the chunk otherwise.
+     */
+    int32_t GetRemoteAbilityInfosChunked(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const RemoteAbilityInfoOptions &options, uint64_t &continuationToken,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos) override;
+
     bool GetDistributedBundleInfo(const std::string &networkId, const std::string &bundleName,
         DistributedBundleInfo &distributedBundleInfo) override;
 
@@ -131,6 +241,15 @@ public:
     int32_t GetBundleVersionCode(const std::string &bundleName, uint32_t &versionCode,
         DistributedBmsAclInfo &info) override;
 
+    int32_t GetRemoteAbilityInfosAsync(const std::vector<ElementName> &elementNames, const std::string &localeInfo,
+        const sptr<IRemoteObject> &callback) override;
+
+    int32_t GetRemoteBundleVersionCodeAsync(const std::string &deviceId, const std::string &bundleName,
+        const sptr<IRemoteObject> &callback) override;
+
+    int32_t GetDistributedBundleInfoAsync(const std::string &networkId, const std::string &bundleName,
+        const sptr<IRemoteObject> &callback) override;
+
     int32_t GetUdidByNetworkId(const std::string &networkId, std::string &udid);
     int32_t GetUuidByNetworkId(const std::string &netWorkId, std::string &uuid);
     bool GetLocalDevice(DistributedHardware::DmDeviceInfo& dmDeviceInfo);
@@ -138,6 +257,22 @@ public:
     bool CheckAclData(DistributedBmsAclInfo info);
 
     DistributedBmsAclInfo BuildDistributedBmsAclInfo();
+
+    /**
+     * @brief resolve the default locale labels and compressed icons of all abilities of the bundle.
+     * @param bundleName Indicates the bundle name.
+     * @param userId Indicates the user id.
+     * @param infos Indicates the precomputed infos.
+     * @return Returns true if the bundle is queried; returns false otherwise.
+     */
+    bool PrecomputeAbilityInfos(const std::string &bundleName, int32_t userId,
+        std::vector<PrecomputedAbilityInfo> &infos);
+
+    /**
+     * @brief get the names of the bundles installed for the user.
+     * @return Returns true if the bundles are queried; returns false otherwise.
+     */
+    bool GetInstalledBundleNames(int32_t userId, std::vector<std::string> &bundleNames);
     /**
      * @brief Start the bundle manager service.
      * @return
@@ -155,17 +290,57 @@ private:
     std::shared_ptr<DistributedMonitor> distributedSub_;
     std::mutex bundleMgrMutex_;
     std::mutex dbmsDeviceManagerMutex_;
+    // identical remote queries of concurrent callers share one remote call
+    DbmsSingleFlight<RemoteAbilityInfo> abilityInfoFlight_;
+    DbmsSingleFlight<std::vector<RemoteAbilityInfo>> abilityInfosFlight_;
+    DbmsSingleFlight<std::vector<RemoteAbilityInfoResult>> partialFlight_;
 
     void Init();
     void InitDeviceManager();
-    bool GetMediaBase64(std::unique_ptr<uint8_t[]> &data, int64_t fileLength,
-        std::string &imageType, std::string &value);
+    bool GetMediaBase64(const uint8_t *data, int64_t fileLength,
+        const std::string &imageType, std::string &value);
     std::unique_ptr<unsigned char[]> LoadResourceFile(std::string &path, int &len);
-    std::unique_ptr<char[]> EncodeBase64(std::unique_ptr<uint8_t[]> &data, int srcLen);
-    int32_t GetAbilityIconByContent(
-        const AbilityInfo &abilityInfo, int32_t userId, RemoteAbilityInfo &remoteAbilityInfo);
-    int32_t Base64WithoutCompress(std::unique_ptr<uint8_t[]> &imageContent, size_t imageContentSize,
+    int32_t QueryAbilityInfoAndLabel(const ElementName &elementName, const std::string &localeInfo,
+        AbilityInfo &abilityInfo, int32_t &userId, std::string &label, bool withLabel = true);
+    int32_t ResolveAbilityInfos(const std::vector<ElementName> &elementNames, const std::string &localeInfo,
+        std::vector<RemoteAbilityInfo> &remoteAbilityInfos);
+    int32_t ResolveAbilityInfo(const ElementName &elementName, const std::string &localeInfo,
+        RemoteAbilityInfo &remoteAbilityInfo);
+    int32_t BuildRemoteAbilityInfo(const ElementName &elementName, AbilityLabelAndIcon &labelAndIcon,
         RemoteAbilityInfo &remoteAbilityInfo);
+    int32_t GetAbilityLabelAndIcon(const ElementName &elementName, const std::string &localeInfo,
+        std::string &label, std::shared_ptr<const IconData> &iconData,
+        const RemoteAbilityInfoOptions &options = RemoteAbilityInfoOptions());
+    void BatchGetAbilityLabelAndIcon(const std::vector<ElementName> &elementNames, const std::string &localeInfo,
+        std::vector<AbilityLabelAndIcon> &results,
+        const RemoteAbilityInfoOptions &options = RemoteAbilityInfoOptions());
+    int32_t GetAbilityIconData(const AbilityInfo &abilityInfo, int32_t userId,
+        std::shared_ptr<const IconData> &iconData, int32_t maxIconEdge = 0);
+    int32_t LoadAbilityIcon(const OHOS::sptr<IBundleMgr> &iBundleMgr, const AbilityInfo &abilityInfo,
+        int32_t userId, std::shared_ptr<const IconData> &iconData, int32_t maxIconEdge = 0);
+    bool GetPrecomputedAbilityInfo(const ElementName &elementName, const std::string &localeInfo,
+        int32_t userId, std::string &label, std::shared_ptr<const IconData> &iconData,
+        const RemoteAbilityInfoOptions &options);
+    int32_t QueryRemoteAbilityInfos(const std::vector<ElementName> &elementNames, const std::string &localeInfo,
+        const DistributedBmsAclInfo &info, std::vector<RemoteAbilityInfo> &remoteAbilityInfos);
+    int32_t FetchRemoteAbilityInfos(const std::vector<ElementName> &elementNames, const std::string &localeInfo,
+        const DistributedBmsAclInfo &info, std::vector<RemoteAbilityInfo> &remoteAbilityInfos);
+    int32_t GetRemoteAbilityInfosFromDevices(size_t count, const std::vector<RemoteDeviceGroup> &groups,
+        const std::string &localeInfo, const DistributedBmsAclInfo &info,
+        std::vector<RemoteAbilityInfo> &remoteAbilityInfos);
+    int32_t QueryRemoteBundleVersionCode(const std::string &deviceId, const std::string &bundleName,
+        const DistributedBmsAclInfo &info, uint32_t &versionCode);
+    int32_t QueryPartialChunk(DbmsQuerySession &session, size_t count,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos);
+    int32_t QueryPartialFromDevice(const DbmsQuerySession &session, const std::string &deviceId,
+        const std::vector<ElementName> &elementNames, std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos);
+    int32_t FetchPartialFromDevice(const DbmsQuerySession &session, const std::string &deviceId,
+        const std::vector<ElementName> &elementNames, std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos);
+    int32_t GetPartialFromOldPeer(const sptr<IDistributedBms> &iDistBundleMgr,
+        const std::vector<ElementName> &elementNames, const std::string &localeInfo, DistributedBmsAclInfo &info,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos);
+    int32_t ConvertToBinaryInfos(const std::vector<RemoteAbilityInfo> &infos,
+        std::vector<RemoteAbilityBinaryInfo> &binaryInfos);
     bool VerifySystemApp();
     bool VerifyTokenNative(Security::AccessToken::AccessTokenID callerToken);
     bool VerifyTokenShell(Security::AccessToken::AccessTokenID callerToken);
@@ -39,8 +39,22 @@ private:
     int HandleGetDistributedBundleName(Parcel &data, Parcel &reply);
     int HandleGetRemoteBundleVersionCode(Parcel &data, Parcel &reply);
     int HandleGetBundleVersionCode(Parcel &data, Parcel &reply);
+    int HandleGetRemoteAbilityInfosWithBinaryIcon(MessageParcel &data, MessageParcel &reply);
+    int HandleGetAbilityInfosWithBinaryIcon(MessageParcel &data, MessageParcel &reply);
+    int HandleGetRemoteAbilityInfosIfModified(Parcel &data, Parcel &reply);
+    int HandleGetAbilityInfosIfModified(Parcel &data, Parcel &reply);
+    int HandleGetRemoteAbilityInfosPartial(Parcel &data, Parcel &reply);
+    int HandleGetAbilityInfosPartial(Parcel &data, Parcel &reply);
+    int HandleGetRemoteAbilityInfosChunked(Parcel &data, Parcel &reply);
+    int HandleGetRemoteAbilityInfosAsync(MessageParcel &data, MessageParcel &reply);
+    int HandleGetRemoteBundleVersionCodeAsync(MessageParcel &data, MessageParcel &reply);
+    int HandleGetDistributedBundleInfoAsync(MessageParcel &data, MessageParcel &reply);
+    bool WriteBinaryInfos(const std::vector<RemoteAbilityBinaryInfo> &infos, MessageParcel &reply);
+    bool ReadRemoteAbilityInfoOptions(Parcel &data, RemoteAbilityInfoOptions &options);
     template <typename T>
     bool GetParcelableInfos(Parcel &data, std::vector<T> &parcelableInfos);
+    template <typename T>
+    bool GetParcelableInfos(Parcel &data, std::vector<T> &parcelableInfos, int32_t maxSize);
     template<typename T>
     bool WriteParcelableVector(std::vector<T> &parcelableVector, Parcel &data);
 };
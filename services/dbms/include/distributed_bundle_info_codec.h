@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BUNDLE_INFO_CODEC_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BUNDLE_INFO_CODEC_H
+
+#include <cstdint>
+#include <vector>
+
+#include "distributed_bundle_info.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * Compact record of a DistributedBundleInfo in the distributed store. A record starts with the schema version
+ * byte, integers are varints, and every string is written once in a string table and referred to by index.
+ */
+class DistributedBundleInfoCodec {
+public:
+    static constexpr uint8_t SCHEMA_VERSION = 1;
+
+    /**
+     * @brief encode the bundle info into a compact record.
+     * @param info Indicates the bundle info.
+     * @return Returns the record.
+     */
+    static std::vector<uint8_t> Encode(const DistributedBundleInfo &info);
+
+    /**
+     * @brief decode a value of the store, either a compact record or the json of a device without the codec.
+     * @param value Indicates the value.
+     * @param info Indicates the bundle info.
+     * @return Returns true if the value is decoded; returns false otherwise.
+     */
+    static bool Decode(const std::vector<uint8_t> &value, DistributedBundleInfo &info);
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_BUNDLE_INFO_CODEC_H
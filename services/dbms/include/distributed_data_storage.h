@@ -47,6 +47,11 @@ private:
     std::string uuid_;
 };
 
+class DistributedDataStorageObserver : public OHOS::DistributedKv::KvStoreObserver {
+public:
+    void OnChange(const DistributedKv::ChangeNotification &changeNotification) override;
+};
+
 class DistributedDataStorage {
 public:
     DistributedDataStorage();
@@ -75,6 +80,8 @@ private:
     std::map<std::string, DistributedBundleInfo> GetAllOldDistributionBundleInfo(
         const std::vector<std::string> &bundleNames);
     bool SyncAndCompleted(const std::string &udid, const std::string &networkId);
+    bool LoadBundleNameIndex(const std::string &udid);
+    static bool IsCompactRecordEnabled();
 private:
     static std::mutex mutex_;
     static std::shared_ptr<DistributedDataStorage> instance_;
@@ -84,6 +91,9 @@ private:
     DistributedKv::DistributedKvDataManager dataManager_;
     std::shared_ptr<DistributedKv::SingleKvStore> kvStorePtr_;
     static std::mutex kvStorePtrMutex_;
+    std::shared_ptr<DistributedDataStorageObserver> observer_ = std::make_shared<DistributedDataStorageObserver>();
+    // without change notifications the bundle name index is loaded again after every sync
+    bool isObserverSubscribed_ = false;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -16,10 +16,17 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_MONITOR_H
 #define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_DISTRIBUTED_MONITOR_H
 
+#include "account_manager_helper.h"
 #include "common_event_manager.h"
 #include "common_event_support.h"
 #include "common_event_subscriber.h"
 #include "common_event_subscribe_info.h"
+#include "dbms_acl_cache.h"
+#include "dbms_acl_info_cache.h"
+#include "dbms_icon_cache.h"
+#include "dbms_icon_store.h"
+#include "dbms_label_cache.h"
+#include "dbms_query_session.h"
 #include "distributed_data_storage.h"
 
 namespace OHOS {
@@ -37,16 +44,43 @@ public:
         if (action == EventFwk::CommonEventSupport::COMMON_EVENT_USER_SWITCHED) {
             int32_t userId = eventData.GetCode();
             APP_LOGI("OnReceiveEvent switched userId:%{public}d", userId);
+            AccountManagerHelper::SetCurrentActiveUserId(userId);
             DistributedDataStorage::GetInstance()->UpdateDistributedData(userId);
+            DbmsIconStore::GetInstance()->Backfill(userId);
+            DbmsLabelCache::GetInstance()->Clear();
+            // the acl info of an open query belongs to the previous user
+            DbmsQuerySessions::GetInstance()->Clear();
+            DbmsAclCache::GetInstance()->Clear();
+            DbmsAclInfoCache::GetInstance()->Clear();
+            return;
+        }
+        if (action == EventFwk::CommonEventSupport::COMMON_EVENT_DISTRIBUTED_ACCOUNT_LOGIN ||
+            action == EventFwk::CommonEventSupport::COMMON_EVENT_DISTRIBUTED_ACCOUNT_LOGOUT ||
+            action == EventFwk::CommonEventSupport::COMMON_EVENT_DISTRIBUTED_ACCOUNT_LOGOFF ||
+            action == EventFwk::CommonEventSupport::COMMON_EVENT_DISTRIBUTED_ACCOUNT_TOKEN_INVALID) {
+            // the acl decisions and the acl info of local callers were made against the previous account
+            DbmsAclCache::GetInstance()->Clear();
+            DbmsAclInfoCache::GetInstance()->Clear();
             return;
         }
         int32_t userId = want.GetIntParam(Constants::USER_ID, Constants::INVALID_USERID);
         std::string bundleName = want.GetElement().GetBundleName();
+        if (action == EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_ADDED ||
+            action == EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED ||
+            action == EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED) {
+            DbmsIconCache::GetInstance()->Invalidate(bundleName);
+            DbmsLabelCache::GetInstance()->Invalidate(bundleName);
+            // the callee token id of the bundle changes when it is reinstalled
+            DbmsAclCache::GetInstance()->Clear();
+        }
         if (action == EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_ADDED ||
             action == EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED) {
             DistributedDataStorage::GetInstance()->SaveStorageDistributeInfo(bundleName, userId);
+            DbmsIconStore::GetInstance()->Schedule(bundleName, userId);
         } else if (action == EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED) {
             DistributedDataStorage::GetInstance()->DeleteStorageDistributeInfo(bundleName, userId);
+            DbmsIconStore::GetInstance()->Remove(bundleName, userId);
+            DbmsAclInfoCache::GetInstance()->Invalidate(bundleName);
         } else {
             APP_LOGW("OnReceiveEvent undefined action");
         }
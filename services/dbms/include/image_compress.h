@@ -20,8 +20,13 @@
 #include <cstdlib>
 #include <string>
 #include <cmath>
+#include <memory>
 
 namespace OHOS {
+namespace Media {
+class ImageSource;
+struct Size;
+}
 namespace AppExecFwk {
     enum class ImageType {
         JPEG = 1,
@@ -38,6 +43,29 @@ public:
     bool GetImageTypeString(const std::unique_ptr<uint8_t[]> &fileData, size_t fileLength, std::string &imageType);
     bool CompressImageByContent(const std::unique_ptr<uint8_t[]> &fileData, size_t fileSize,
         std::unique_ptr<uint8_t[]> &compressedData, int64_t &compressedSize, std::string &imageType);
+    /**
+     * @brief give the buffer got from CompressImageByContent back to the packing buffer pool.
+     */
+    void ReleaseCompressedData(std::unique_ptr<uint8_t[]> &compressedData);
+    /**
+     * @brief decode directly to the compressed size when enabled, otherwise decode full size and scale, default on.
+     */
+    void SetDecodeScaleEnabled(bool enabled);
+    /**
+     * @brief limit the longer edge of the image CompressImageByContent produces, 0 for no limit, default 0.
+     */
+    void SetMaxEdge(int32_t maxEdge);
+    /**
+     * @brief check whether the longer edge of the image exceeds the limit set by SetMaxEdge.
+     */
+    bool IsImageNeedCompressByEdge(const std::unique_ptr<uint8_t[]> &fileData, size_t fileSize);
+
+private:
+    bool GetTargetSize(Media::ImageSource &imageSource, double ratio, Media::Size &targetSize);
+    double LimitRatioByEdge(Media::ImageSource &imageSource, size_t fileSize, double ratio);
+
+    bool decodeScaleEnabled_ = true;
+    int32_t maxEdge_ = 0;
 };
 }
 }
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_PACKING_BUFFER_POOL_H
+#define FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_PACKING_BUFFER_POOL_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace OHOS {
+namespace AppExecFwk {
+struct PackingBufferPoolStats {
+    uint64_t acquireCount = 0;
+    uint64_t hitCount = 0;
+    size_t bufferSize = 0;
+    size_t pooledBytes = 0;
+    size_t outstandingBytes = 0;
+    size_t highWaterBytes = 0;
+};
+
+class PackingBufferPool {
+public:
+    PackingBufferPool(size_t minBufferSize, size_t maxBufferSize, size_t maxPooledBuffers);
+    ~PackingBufferPool() = default;
+    static std::shared_ptr<PackingBufferPool> GetInstance();
+
+    /**
+     * @brief take a pre-faulted buffer for image packing, reuse a pooled one when possible.
+     * @param minCapacity Indicates the minimum capacity, 0 means the size learnt from packed sizes.
+     * @param capacity Indicates the capacity of the returned buffer.
+     * @return Returns the buffer, nullptr if allocating failed.
+     */
+    std::unique_ptr<uint8_t[]> Acquire(size_t minCapacity, size_t &capacity);
+
+    /**
+     * @brief give a buffer got from Acquire back to the pool, buffers not from the pool are freed.
+     */
+    void Release(std::unique_ptr<uint8_t[]> buffer);
+
+    /**
+     * @brief record a packed size so the buffer size follows what the icons actually need.
+     */
+    void RecordPackedSize(size_t packedSize);
+    size_t GetMaxBufferSize() const;
+    PackingBufferPoolStats GetStats();
+
+private:
+    static std::unique_ptr<uint8_t[]> AllocateBuffer(size_t capacity);
+    size_t GetBufferSizeLocked() const;
+    void TrackLocked(const uint8_t *buffer, size_t capacity);
+    void UpdateHighWaterLocked();
+
+    static std::mutex instanceMutex_;
+    static std::shared_ptr<PackingBufferPool> instance_;
+
+    std::mutex mutex_;
+    const size_t minBufferSize_;
+    const size_t maxBufferSize_;
+    const size_t maxPooledBuffers_;
+    size_t maxPackedSize_ = 0;
+    std::vector<std::pair<std::unique_ptr<uint8_t[]>, size_t>> pooled_;
+    std::unordered_map<const uint8_t *, size_t> outstanding_;
+    PackingBufferPoolStats stats_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_DBMS_INCLUDE_PACKING_BUFFER_POOL_H
@@ -22,7 +22,37 @@
 
 namespace OHOS {
 namespace AppExecFwk {
+std::atomic<int32_t> AccountManagerHelper::currentActiveUserId_ {Constants::INVALID_USERID};
+
 int32_t AccountManagerHelper::GetCurrentActiveUserId()
+{
+    int32_t userId = currentActiveUserId_.load();
+    if (userId != Constants::INVALID_USERID) {
+        return userId;
+    }
+    return InitCurrentActiveUserId(QueryCurrentActiveUserId());
+}
+
+void AccountManagerHelper::SetCurrentActiveUserId(int32_t userId)
+{
+    APP_LOGI("current active user %{public}d", userId);
+    currentActiveUserId_.store(userId);
+}
+
+int32_t AccountManagerHelper::InitCurrentActiveUserId(int32_t queriedUserId)
+{
+    if (queriedUserId == Constants::INVALID_USERID) {
+        return queriedUserId;
+    }
+    // a user switch received while querying wins, the queried user may already be in the background
+    int32_t expected = Constants::INVALID_USERID;
+    if (currentActiveUserId_.compare_exchange_strong(expected, queriedUserId)) {
+        return queriedUserId;
+    }
+    return expected;
+}
+
+int32_t AccountManagerHelper::QueryCurrentActiveUserId()
 {
 #ifdef ACCOUNT_ENABLE
     std::int32_t localId;
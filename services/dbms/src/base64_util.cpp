@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base64_util.h"
+
+#include <array>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define DBMS_BASE64_X86
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define DBMS_BASE64_NEON
+#include <arm_neon.h>
+#endif
+
+#include "app_log_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+    constexpr size_t GROUP_SRC_SIZE = 3;
+    constexpr size_t GROUP_DST_SIZE = 4;
+    constexpr uint8_t SHIFT_TWO = 2;
+    constexpr uint8_t SHIFT_FOUR = 4;
+    constexpr uint8_t SHIFT_SIX = 6;
+    constexpr uint8_t MASK_TWO_BITS = 0x03;
+    constexpr uint8_t MASK_FOUR_BITS = 0x0F;
+    constexpr uint8_t MASK_SIX_BITS = 0x3F;
+    constexpr char PAD_CHAR = '=';
+    constexpr size_t BITS_PER_BYTE = 8;
+    constexpr char ENCODE_TABLE[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    constexpr uint8_t INVALID_CHAR = 0xFF;
+    constexpr size_t DECODE_TABLE_SIZE = 256;
+
+    int32_t DecodeChar(char c)
+    {
+        static const auto decodeTable = [] {
+            std::array<uint8_t, DECODE_TABLE_SIZE> table;
+            table.fill(INVALID_CHAR);
+            for (size_t i = 0; i + 1 < sizeof(ENCODE_TABLE); ++i) {
+                table[static_cast<uint8_t>(ENCODE_TABLE[i])] = static_cast<uint8_t>(i);
+            }
+            return table;
+        }();
+        uint8_t value = decodeTable[static_cast<uint8_t>(c)];
+        return value == INVALID_CHAR ? -1 : value;
+    }
+
+    using BlockEncoder = size_t (*)(const uint8_t *src, size_t srcLen, char *dst);
+
+    size_t EncodeTail(const uint8_t *src, size_t srcLen, char *dst)
+    {
+        size_t i = 0;
+        size_t j = 0;
+        for (; i + GROUP_SRC_SIZE <= srcLen; i += GROUP_SRC_SIZE, j += GROUP_DST_SIZE) {
+            uint8_t byte1 = src[i];
+            uint8_t byte2 = src[i + 1];
+            uint8_t byte3 = src[i + SHIFT_TWO];
+            char c0 = ENCODE_TABLE[byte1 >> SHIFT_TWO];
+            char c1 = ENCODE_TABLE[((byte1 & MASK_TWO_BITS) << SHIFT_FOUR) | (byte2 >> SHIFT_FOUR)];
+            char c2 = ENCODE_TABLE[((byte2 & MASK_FOUR_BITS) << SHIFT_TWO) | (byte3 >> SHIFT_SIX)];
+            char c3 = ENCODE_TABLE[byte3 & MASK_SIX_BITS];
+            // write after all loads so the compiler need not assume dst aliases src
+            dst[j] = c0;
+            dst[j + 1] = c1;
+            dst[j + SHIFT_TWO] = c2;
+            dst[j + GROUP_SRC_SIZE] = c3;
+        }
+        size_t remain = srcLen - i;
+        if (remain == 1) {
+            uint8_t byte1 = src[i];
+            dst[j++] = ENCODE_TABLE[byte1 >> SHIFT_TWO];
+            dst[j++] = ENCODE_TABLE[(byte1 & MASK_TWO_BITS) << SHIFT_FOUR];
+            dst[j++] = PAD_CHAR;
+            dst[j++] = PAD_CHAR;
+        } else if (remain == SHIFT_TWO) {
+            uint8_t byte1 = src[i];
+            uint8_t byte2 = src[i + 1];
+            dst[j++] = ENCODE_TABLE[byte1 >> SHIFT_TWO];
+            dst[j++] = ENCODE_TABLE[((byte1 & MASK_TWO_BITS) << SHIFT_FOUR) | (byte2 >> SHIFT_FOUR)];
+            dst[j++] = ENCODE_TABLE[(byte2 & MASK_FOUR_BITS) << SHIFT_TWO];
+            dst[j++] = PAD_CHAR;
+        }
+        return j;
+    }
+
+#ifdef DBMS_BASE64_X86
+    // Split 12 bytes of each 128 bit lane into 16 six-bit indices, see Wojciech Mula's base64 SSE encoder.
+    __attribute__((target("ssse3"))) inline __m128i UnpackSse(__m128i in)
+    {
+        in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+        const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+        const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+        const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+        return _mm_or_si128(t1, t3);
+    }
+
+    __attribute__((target("ssse3"))) inline __m128i LookupSse(__m128i indices)
+    {
+        const __m128i shiftLut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+        __m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+        result = _mm_shuffle_epi8(shiftLut, result);
+        return _mm_add_epi8(result, indices);
+    }
+
+    __attribute__((target("ssse3"))) size_t EncodeBlocksSsse3(const uint8_t *src, size_t srcLen, char *dst)
+    {
+        constexpr size_t srcStep = 12;
+        constexpr size_t dstStep = 16;
+        constexpr size_t loadSize = 16;
+        size_t i = 0;
+        size_t j = 0;
+        for (; i + loadSize <= srcLen; i += srcStep, j += dstStep) {
+            __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j), LookupSse(UnpackSse(in)));
+        }
+        return i;
+    }
+
+    __attribute__((target("avx2"))) inline __m256i LookupAvx2(__m256i indices)
+    {
+        const __m256i shiftLut = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+        __m256i result = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        result = _mm256_or_si256(result, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+        result = _mm256_shuffle_epi8(shiftLut, result);
+        return _mm256_add_epi8(result, indices);
+    }
+
+    __attribute__((target("avx2"))) size_t EncodeBlocksAvx2(const uint8_t *src, size_t srcLen, char *dst)
+    {
+        constexpr size_t srcStep = 24;
+        constexpr size_t dstStep = 32;
+        constexpr size_t laneOffset = 12;
+        constexpr size_t loadSize = laneOffset + 16;
+        const __m256i shuffle = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+            1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+        size_t i = 0;
+        size_t j = 0;
+        for (; i + loadSize <= srcLen; i += srcStep, j += dstStep) {
+            __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+            __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + laneOffset));
+            __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+            in = _mm256_shuffle_epi8(in, shuffle);
+            const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+            const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+            const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+            const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+            __m256i indices = _mm256_or_si256(t1, t3);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + j), LookupAvx2(indices));
+        }
+        return i;
+    }
+#endif
+
+#ifdef DBMS_BASE64_NEON
+    size_t EncodeBlocksNeon(const uint8_t *src, size_t srcLen, char *dst)
+    {
+        constexpr size_t srcStep = 48;
+        constexpr size_t dstStep = 64;
+        constexpr size_t tableStep = 16;
+        const uint8_t *table = reinterpret_cast<const uint8_t *>(ENCODE_TABLE);
+        uint8x16x4_t lut;
+        lut.val[0] = vld1q_u8(table);
+        lut.val[1] = vld1q_u8(table + tableStep);
+        lut.val[2] = vld1q_u8(table + tableStep * 2);
+        lut.val[3] = vld1q_u8(table + tableStep * 3);
+        const uint8x16_t mask = vdupq_n_u8(MASK_SIX_BITS);
+        size_t i = 0;
+        size_t j = 0;
+        for (; i + srcStep <= srcLen; i += srcStep, j += dstStep) {
+            uint8x16x3_t in = vld3q_u8(src + i);
+            uint8x16x4_t out;
+            out.val[0] = vshrq_n_u8(in.val[0], SHIFT_TWO);
+            out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], SHIFT_FOUR), vshrq_n_u8(in.val[1], SHIFT_FOUR)), mask);
+            out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], SHIFT_TWO), vshrq_n_u8(in.val[2], SHIFT_SIX)), mask);
+            out.val[3] = vandq_u8(in.val[2], mask);
+            out.val[0] = vqtbl4q_u8(lut, out.val[0]);
+            out.val[1] = vqtbl4q_u8(lut, out.val[1]);
+            out.val[2] = vqtbl4q_u8(lut, out.val[2]);
+            out.val[3] = vqtbl4q_u8(lut, out.val[3]);
+            vst4q_u8(reinterpret_cast<uint8_t *>(dst + j), out);
+        }
+        return i;
+    }
+#endif
+
+    // the scalar encoder has no block encoder, the tail loop encodes the whole input
+    BlockEncoder GetBlockEncoder(Base64EncoderType type)
+    {
+        switch (type) {
+#ifdef DBMS_BASE64_X86
+            case Base64EncoderType::SSSE3:
+                return EncodeBlocksSsse3;
+            case Base64EncoderType::AVX2:
+                return EncodeBlocksAvx2;
+#endif
+#ifdef DBMS_BASE64_NEON
+            case Base64EncoderType::NEON:
+                return EncodeBlocksNeon;
+#endif
+            default:
+                return nullptr;
+        }
+    }
+
+    Base64EncoderType DetectEncoderType()
+    {
+        if (Base64Util::IsEncoderSupported(Base64EncoderType::AVX2)) {
+            return Base64EncoderType::AVX2;
+        }
+        if (Base64Util::IsEncoderSupported(Base64EncoderType::NEON)) {
+            return Base64EncoderType::NEON;
+        }
+        if (Base64Util::IsEncoderSupported(Base64EncoderType::SSSE3)) {
+            return Base64EncoderType::SSSE3;
+        }
+        return Base64EncoderType::SCALAR;
+    }
+}
+
+size_t Base64Util::GetEncodedLength(size_t srcLen)
+{
+    // Split 3 bytes to 4 parts, each containing 6 bits, the last partial group is padded.
+    return (srcLen + GROUP_SRC_SIZE - 1) / GROUP_SRC_SIZE * GROUP_DST_SIZE;
+}
+
+bool Base64Util::IsEncoderSupported(Base64EncoderType type)
+{
+    switch (type) {
+        case Base64EncoderType::SCALAR:
+            return true;
+#ifdef DBMS_BASE64_X86
+        case Base64EncoderType::SSSE3:
+            return __builtin_cpu_supports("ssse3");
+        case Base64EncoderType::AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+#ifdef DBMS_BASE64_NEON
+        case Base64EncoderType::NEON:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+Base64EncoderType Base64Util::GetEncoderType()
+{
+    static const Base64EncoderType encoderType = DetectEncoderType();
+    return encoderType;
+}
+
+size_t Base64Util::Encode(const uint8_t *src, size_t srcLen, char *dst)
+{
+    return Encode(src, srcLen, dst, GetEncoderType());
+}
+
+size_t Base64Util::Encode(const uint8_t *src, size_t srcLen, char *dst, Base64EncoderType type)
+{
+    if (src == nullptr || dst == nullptr || srcLen == 0) {
+        return 0;
+    }
+    if (!IsEncoderSupported(type)) {
+        APP_LOGD("base64 encoder %{public}d not supported, use scalar", static_cast<int32_t>(type));
+        type = Base64EncoderType::SCALAR;
+    }
+    BlockEncoder blockEncoder = GetBlockEncoder(type);
+    size_t consumed = blockEncoder == nullptr ? 0 : blockEncoder(src, srcLen, dst);
+    size_t written = consumed / GROUP_SRC_SIZE * GROUP_DST_SIZE;
+    return written + EncodeTail(src + consumed, srcLen - consumed, dst + written);
+}
+
+bool Base64Util::Decode(const char *src, size_t srcLen, std::vector<uint8_t> &dst)
+{
+    dst.clear();
+    if (srcLen == 0) {
+        return true;
+    }
+    if (src == nullptr || srcLen % GROUP_DST_SIZE != 0) {
+        return false;
+    }
+    size_t padding = 0;
+    while (padding < SHIFT_TWO && src[srcLen - 1 - padding] == PAD_CHAR) {
+        padding++;
+    }
+    dst.reserve(srcLen / GROUP_DST_SIZE * GROUP_SRC_SIZE);
+    for (size_t i = 0; i < srcLen; i += GROUP_DST_SIZE) {
+        bool last = i + GROUP_DST_SIZE == srcLen;
+        size_t chars = last ? GROUP_DST_SIZE - padding : GROUP_DST_SIZE;
+        uint32_t group = 0;
+        for (size_t j = 0; j < GROUP_DST_SIZE; ++j) {
+            int32_t value = j < chars ? DecodeChar(src[i + j]) : 0;
+            if (value < 0) {
+                return false;
+            }
+            group = (group << SHIFT_SIX) | static_cast<uint32_t>(value);
+        }
+        // the first chars - 1 bytes of the group are meaningful
+        for (size_t j = 0; j + 1 < chars; ++j) {
+            dst.push_back(static_cast<uint8_t>(group >> ((SHIFT_TWO - j) * BITS_PER_BYTE)));
+        }
+    }
+    return true;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
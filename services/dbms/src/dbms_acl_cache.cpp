@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbms_acl_cache.h"
+
+#include "app_log_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+    constexpr size_t DEFAULT_ACL_CACHE_CAPACITY = 64;
+    // short enough that a revoked trust relationship is not honoured for long even if no event arrives
+    constexpr std::chrono::milliseconds DEFAULT_ACL_CACHE_TTL(5 * 1000);
+    constexpr char KEY_SEPARATOR = '/';
+}
+
+std::mutex DbmsAclCache::instanceMutex_;
+std::shared_ptr<DbmsAclCache> DbmsAclCache::instance_ = nullptr;
+
+DbmsAclCache::DbmsAclCache(size_t capacity, std::chrono::milliseconds ttl) : capacity_(capacity), ttl_(ttl)
+{
+}
+
+std::shared_ptr<DbmsAclCache> DbmsAclCache::GetInstance()
+{
+    if (instance_ == nullptr) {
+        std::lock_guard<std::mutex> lock(instanceMutex_);
+        if (instance_ == nullptr) {
+            instance_ = std::make_shared<DbmsAclCache>(DEFAULT_ACL_CACHE_CAPACITY, DEFAULT_ACL_CACHE_TTL);
+        }
+    }
+    return instance_;
+}
+
+std::string DbmsAclCache::KeyToString(const std::string &networkId, const DistributedBmsAclInfo &info)
+{
+    std::string result;
+    result.append(networkId).push_back(KEY_SEPARATOR);
+    result.append(info.accountId).push_back(KEY_SEPARATOR);
+    result.append(std::to_string(info.userId)).push_back(KEY_SEPARATOR);
+    result.append(std::to_string(info.tokenId)).push_back(KEY_SEPARATOR);
+    result.append(info.pkgName);
+    return result;
+}
+
+bool DbmsAclCache::Get(const std::string &networkId, const DistributedBmsAclInfo &info, bool &allowed)
+{
+    if (networkId.empty()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto item = entries_.find(KeyToString(networkId, info));
+    if (item == entries_.end()) {
+        return false;
+    }
+    if (std::chrono::steady_clock::now() - item->second.time > ttl_) {
+        entries_.erase(item);
+        return false;
+    }
+    allowed = item->second.allowed;
+    return true;
+}
+
+void DbmsAclCache::Put(const std::string &networkId, const DistributedBmsAclInfo &info, bool allowed)
+{
+    if (networkId.empty() || capacity_ == 0) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    std::string key = KeyToString(networkId, info);
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.erase(key);
+    for (auto it = entries_.begin(); it != entries_.end() && entries_.size() >= capacity_;) {
+        if (now - it->second.time > ttl_) {
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    while (entries_.size() >= capacity_) {
+        auto oldest = entries_.begin();
+        for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+            if (it->second.time < oldest->second.time) {
+                oldest = it;
+            }
+        }
+        entries_.erase(oldest);
+    }
+    entries_[key] = AclCacheEntry { allowed, now };
+}
+
+void DbmsAclCache::Invalidate(const std::string &networkId)
+{
+    if (networkId.empty()) {
+        return;
+    }
+    std::string prefix = networkId + KEY_SEPARATOR;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto begin = entries_.lower_bound(prefix);
+    auto end = begin;
+    while (end != entries_.end() && end->first.compare(0, prefix.size(), prefix) == 0) {
+        ++end;
+    }
+    entries_.erase(begin, end);
+}
+
+void DbmsAclCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+}
+
+size_t DbmsAclCache::GetCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
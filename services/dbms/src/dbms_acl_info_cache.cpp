@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbms_acl_info_cache.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+    constexpr size_t DEFAULT_ACL_INFO_CACHE_CAPACITY = 64;
+}
+
+std::mutex DbmsAclInfoCache::instanceMutex_;
+std::shared_ptr<DbmsAclInfoCache> DbmsAclInfoCache::instance_ = nullptr;
+
+DbmsAclInfoCache::DbmsAclInfoCache(size_t capacity) : capacity_(capacity)
+{
+}
+
+std::shared_ptr<DbmsAclInfoCache> DbmsAclInfoCache::GetInstance()
+{
+    if (instance_ == nullptr) {
+        std::lock_guard<std::mutex> lock(instanceMutex_);
+        if (instance_ == nullptr) {
+            instance_ = std::make_shared<DbmsAclInfoCache>(DEFAULT_ACL_INFO_CACHE_CAPACITY);
+        }
+    }
+    return instance_;
+}
+
+bool DbmsAclInfoCache::Get(int32_t uid, int32_t userId, DistributedBmsAclInfo &info)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto item = infos_.find(std::make_pair(uid, userId));
+    if (item == infos_.end()) {
+        return false;
+    }
+    info = item->second;
+    return true;
+}
+
+void DbmsAclInfoCache::Put(int32_t uid, int32_t userId, const DistributedBmsAclInfo &info)
+{
+    if (capacity_ == 0) {
+        return;
+    }
+    auto key = std::make_pair(uid, userId);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (infos_.find(key) == infos_.end() && infos_.size() >= capacity_) {
+        // callers are few and cheap to rebuild, no need to track the recency
+        infos_.erase(infos_.begin());
+    }
+    infos_[key] = info;
+}
+
+void DbmsAclInfoCache::Invalidate(const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = infos_.begin(); it != infos_.end();) {
+        if (it->second.pkgName == bundleName) {
+            it = infos_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void DbmsAclInfoCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    infos_.clear();
+}
+
+size_t DbmsAclInfoCache::GetCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return infos_.size();
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
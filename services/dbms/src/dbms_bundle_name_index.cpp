@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbms_bundle_name_index.h"
+
+#include "app_log_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+std::mutex DbmsBundleNameIndex::instanceMutex_;
+std::shared_ptr<DbmsBundleNameIndex> DbmsBundleNameIndex::instance_ = nullptr;
+
+std::shared_ptr<DbmsBundleNameIndex> DbmsBundleNameIndex::GetInstance()
+{
+    if (instance_ == nullptr) {
+        std::lock_guard<std::mutex> lock(instanceMutex_);
+        if (instance_ == nullptr) {
+            instance_ = std::make_shared<DbmsBundleNameIndex>();
+        }
+    }
+    return instance_;
+}
+
+bool DbmsBundleNameIndex::Get(const std::string &udid, uint32_t accessTokenId, std::string &bundleName)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto device = devices_.find(udid);
+    if (device == devices_.end()) {
+        return false;
+    }
+    auto item = device->second.bundleNames.find(accessTokenId);
+    if (item == device->second.bundleNames.end()) {
+        return false;
+    }
+    bundleName = item->second;
+    return true;
+}
+
+bool DbmsBundleNameIndex::IsLoaded(const std::string &udid)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto device = devices_.find(udid);
+    return device != devices_.end() && device->second.loaded;
+}
+
+bool DbmsBundleNameIndex::Load(const std::string &udid, const std::function<bool(Rows &)> &fetch)
+{
+    std::lock_guard<std::mutex> updateLock(updateMutex_);
+    Rows rows;
+    if (!fetch(rows)) {
+        return false;
+    }
+    DeviceIndex device;
+    for (const auto &row : rows) {
+        PutLocked(device, row.first, row.second);
+    }
+    device.loaded = true;
+    std::lock_guard<std::mutex> lock(mutex_);
+    devices_[udid] = std::move(device);
+    APP_LOGI("index %{public}d bundles of a device", static_cast<int32_t>(rows.size()));
+    return true;
+}
+
+void DbmsBundleNameIndex::Put(const std::string &udid, const std::string &bundleName, uint32_t accessTokenId)
+{
+    std::lock_guard<std::mutex> updateLock(updateMutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    PutLocked(devices_[udid], bundleName, accessTokenId);
+}
+
+void DbmsBundleNameIndex::Remove(const std::string &udid, const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> updateLock(updateMutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto device = devices_.find(udid);
+    if (device == devices_.end()) {
+        return;
+    }
+    auto item = device->second.accessTokenIds.find(bundleName);
+    if (item == device->second.accessTokenIds.end()) {
+        return;
+    }
+    auto bundleNameItem = device->second.bundleNames.find(item->second);
+    if (bundleNameItem != device->second.bundleNames.end() && bundleNameItem->second == bundleName) {
+        device->second.bundleNames.erase(bundleNameItem);
+    }
+    device->second.accessTokenIds.erase(item);
+}
+
+void DbmsBundleNameIndex::Invalidate(const std::string &udid)
+{
+    std::lock_guard<std::mutex> updateLock(updateMutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    devices_.erase(udid);
+}
+
+void DbmsBundleNameIndex::BindNetworkId(const std::string &networkId, const std::string &udid)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    udids_[networkId] = udid;
+}
+
+void DbmsBundleNameIndex::InvalidateByNetworkId(const std::string &networkId)
+{
+    std::lock_guard<std::mutex> updateLock(updateMutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto item = udids_.find(networkId);
+    if (item == udids_.end()) {
+        return;
+    }
+    devices_.erase(item->second);
+    udids_.erase(item);
+}
+
+void DbmsBundleNameIndex::Clear()
+{
+    std::lock_guard<std::mutex> updateLock(updateMutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    devices_.clear();
+    udids_.clear();
+}
+
+void DbmsBundleNameIndex::PutLocked(DeviceIndex &device, const std::string &bundleName, uint32_t accessTokenId)
+{
+    auto item = device.accessTokenIds.find(bundleName);
+    if (item != device.accessTokenIds.end()) {
+        if (item->second == accessTokenId) {
+            return;
+        }
+        auto bundleNameItem = device.bundleNames.find(item->second);
+        if (bundleNameItem != device.bundleNames.end() && bundleNameItem->second == bundleName) {
+            device.bundleNames.erase(bundleNameItem);
+        }
+    }
+    device.accessTokenIds[bundleName] = accessTokenId;
+    device.bundleNames[accessTokenId] = bundleName;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
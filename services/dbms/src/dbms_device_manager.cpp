@@ -15,9 +15,15 @@
 
 #include "dbms_device_manager.h"
 
+#include <cstring>
+
 #include "account_manager_helper.h"
 #include "app_log_wrapper.h"
 #include "bundle_constants.h"
+#include "dbms_acl_cache.h"
+#include "dbms_acl_info_cache.h"
+#include "dbms_bundle_name_index.h"
+#include "dbms_remote_proxy_cache.h"
 #include "device_manager.h"
 #include "ipc_skeleton.h"
 #include "service_control.h"
@@ -30,6 +36,10 @@ namespace {
     const std::string SERVICES_NAME = "d-bms";
 }
 
+std::mutex DbmsDeviceManager::localDeviceMutex_;
+uint64_t DbmsDeviceManager::localDeviceVersion_ = 0;
+std::shared_ptr<const DistributedHardware::DmDeviceInfo> DbmsDeviceManager::localDevice_ = nullptr;
+
 DbmsDeviceManager::DbmsDeviceManager()
 {
     APP_LOGI("DbmsDeviceManager instance is created");
@@ -37,6 +47,9 @@ DbmsDeviceManager::DbmsDeviceManager()
 
 bool DbmsDeviceManager::InitDeviceManager()
 {
+    if (isInit_) {
+        return true;
+    }
     std::lock_guard<std::mutex> lock(isInitMutex_);
     if (isInit_) {
         APP_LOGI("device manager already init");
@@ -50,6 +63,13 @@ bool DbmsDeviceManager::InitDeviceManager()
         APP_LOGE("init device manager failed, ret:%{public}d", ret);
         return false;
     }
+    stateCallback_ = std::make_shared<DeviceStateCallBack>();
+    ret = DistributedHardware::DeviceManager::GetInstance().RegisterDevStateCallback(
+        DISTRIBUTED_BUNDLE_NAME, "", stateCallback_);
+    if (ret != 0) {
+        // acl decisions then only age out by their ttl
+        APP_LOGW("register device state callback failed, ret:%{public}d", ret);
+    }
     isInit_ = true;
     APP_LOGI("register device manager success");
     return true;
@@ -58,6 +78,35 @@ bool DbmsDeviceManager::InitDeviceManager()
 void DbmsDeviceManager::DeviceInitCallBack::OnRemoteDied()
 {
     APP_LOGI("DeviceInitCallBack OnRemoteDied");
+    DbmsAclCache::GetInstance()->Clear();
+    // the network id of the local device may change once the device manager is back
+    DbmsAclInfoCache::GetInstance()->Clear();
+    ResetLocalDevice();
+}
+
+void DbmsDeviceManager::DeviceStateCallBack::OnDeviceOnline(const DistributedHardware::DmDeviceInfo &deviceInfo)
+{
+    DbmsAclCache::GetInstance()->Invalidate(deviceInfo.networkId);
+}
+
+void DbmsDeviceManager::DeviceStateCallBack::OnDeviceOffline(const DistributedHardware::DmDeviceInfo &deviceInfo)
+{
+    DbmsAclCache::GetInstance()->Invalidate(deviceInfo.networkId);
+    // the death of a remote proxy may be reported late or never once the link is gone
+    DbmsRemoteProxyCache::GetInstance()->Remove(deviceInfo.networkId);
+    // the kv store keeps no notification for the data of an offline device, it is loaded again once online
+    DbmsBundleNameIndex::GetInstance()->InvalidateByNetworkId(deviceInfo.networkId);
+}
+
+void DbmsDeviceManager::DeviceStateCallBack::OnDeviceChanged(const DistributedHardware::DmDeviceInfo &deviceInfo)
+{
+    DbmsAclCache::GetInstance()->Invalidate(deviceInfo.networkId);
+    OnDeviceInfoChanged(deviceInfo);
+}
+
+void DbmsDeviceManager::DeviceStateCallBack::OnDeviceReady(const DistributedHardware::DmDeviceInfo &deviceInfo)
+{
+    DbmsAclCache::GetInstance()->Invalidate(deviceInfo.networkId);
 }
 
 int32_t DbmsDeviceManager::GetUdidByNetworkId(const std::string &netWorkId, std::string &udid)
@@ -86,26 +135,69 @@ int32_t DbmsDeviceManager::GetUuidByNetworkId(const std::string &netWorkId, std:
 
 bool DbmsDeviceManager::GetLocalDevice(DistributedHardware::DmDeviceInfo& dmDeviceInfo)
 {
+    auto localDevice = std::atomic_load(&localDevice_);
+    if (localDevice != nullptr) {
+        dmDeviceInfo = *localDevice;
+        return true;
+    }
     APP_LOGI("GetLocalDeviceId");
     if (!InitDeviceManager()) {
         return false;
     }
+    uint64_t version = 0;
+    {
+        std::lock_guard<std::mutex> lock(localDeviceMutex_);
+        version = localDeviceVersion_;
+    }
+    auto deviceInfo = std::make_shared<DistributedHardware::DmDeviceInfo>();
     int32_t ret = DistributedHardware::DeviceManager::GetInstance()
-        .GetLocalDeviceInfo(DISTRIBUTED_BUNDLE_NAME, dmDeviceInfo);
+        .GetLocalDeviceInfo(DISTRIBUTED_BUNDLE_NAME, *deviceInfo);
     if (ret != ERR_OK) {
         APP_LOGE("GetLocalDeviceInfo failed");
         return false;
     }
+    dmDeviceInfo = *deviceInfo;
+    std::lock_guard<std::mutex> lock(localDeviceMutex_);
+    // a reset during the query means the info may already be stale, the next call queries again
+    if (version == localDeviceVersion_) {
+        std::atomic_store(&localDevice_, std::shared_ptr<const DistributedHardware::DmDeviceInfo>(deviceInfo));
+    }
     return true;
 }
 
+void DbmsDeviceManager::ResetLocalDevice()
+{
+    std::lock_guard<std::mutex> lock(localDeviceMutex_);
+    ++localDeviceVersion_;
+    std::atomic_store(&localDevice_, std::shared_ptr<const DistributedHardware::DmDeviceInfo>());
+}
+
+void DbmsDeviceManager::OnDeviceInfoChanged(const DistributedHardware::DmDeviceInfo &deviceInfo)
+{
+    auto localDevice = std::atomic_load(&localDevice_);
+    if (localDevice == nullptr) {
+        return;
+    }
+    if (strncmp(localDevice->deviceId, deviceInfo.deviceId, sizeof(deviceInfo.deviceId)) == 0 ||
+        strncmp(localDevice->networkId, deviceInfo.networkId, sizeof(deviceInfo.networkId)) == 0) {
+        APP_LOGI("local device changed");
+        ResetLocalDevice();
+    }
+}
+
 bool DbmsDeviceManager::CheckAclData(DistributedBmsAclInfo info)
 {
 #ifdef ACCOUNT_ENABLE
+    std::string callingNetworkId = IPCSkeleton::GetCallingDeviceID();
+    bool allowed = false;
+    if (DbmsAclCache::GetInstance()->Get(callingNetworkId, info, allowed)) {
+        APP_LOGD("acl decision %{public}d cached", allowed);
+        return allowed;
+    }
     DistributedHardware::DmAccessCaller dmSrecaller = {
         .accountId = info.accountId,
         .pkgName = info.pkgName,
-        .networkId = IPCSkeleton::GetCallingDeviceID(),
+        .networkId = callingNetworkId,
         .userId = info.userId,
         .tokenId = info.tokenId
     };
@@ -124,7 +216,9 @@ bool DbmsDeviceManager::CheckAclData(DistributedBmsAclInfo info)
         .userId = AccountManagerHelper::GetCurrentActiveUserId(),
         .tokenId = OHOS::Security::AccessToken::AccessTokenKit::GetHapTokenID(dmDstCallee.userId, info.pkgName, 0)
     };
-    return DistributedHardware::DeviceManager::GetInstance().CheckAccessControl(dmSrecaller, dmDstCallee);
+    allowed = DistributedHardware::DeviceManager::GetInstance().CheckAccessControl(dmSrecaller, dmDstCallee);
+    DbmsAclCache::GetInstance()->Put(callingNetworkId, info, allowed);
+    return allowed;
 #else
     APP_LOGI("ACCOUNT_ENABLE is false");
     return false;
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbms_icon_cache.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+#include "app_log_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+    constexpr size_t DEFAULT_ICON_CACHE_CAPACITY = 8 * 1024 * 1024;
+    constexpr char KEY_SEPARATOR = '/';
+    constexpr size_t KEY_NUMBER_RESERVE = 40;
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+    constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+    constexpr int32_t HASH_HEX_WIDTH = 16;
+    constexpr char HASH_SEPARATOR = '-';
+}
+
+void IconData::Assign(const uint8_t *bytes, size_t length)
+{
+    std::shared_ptr<uint8_t> buffer(new uint8_t[length], std::default_delete<uint8_t[]>());
+    std::copy(bytes, bytes + length, buffer.get());
+    data = buffer;
+    size = length;
+}
+
+std::mutex DbmsIconCache::instanceMutex_;
+std::shared_ptr<DbmsIconCache> DbmsIconCache::instance_ = nullptr;
+
+DbmsIconCache::DbmsIconCache(size_t capacity) : capacity_(capacity)
+{
+}
+
+std::shared_ptr<DbmsIconCache> DbmsIconCache::GetInstance()
+{
+    if (instance_ == nullptr) {
+        std::lock_guard<std::mutex> lock(instanceMutex_);
+        if (instance_ == nullptr) {
+            instance_ = std::make_shared<DbmsIconCache>(DEFAULT_ICON_CACHE_CAPACITY);
+        }
+    }
+    return instance_;
+}
+
+std::string DbmsIconCache::KeyToString(const IconCacheKey &key)
+{
+    std::string result;
+    result.reserve(key.bundleName.size() + key.moduleName.size() + key.abilityName.size() + KEY_NUMBER_RESERVE);
+    result.append(key.bundleName).push_back(KEY_SEPARATOR);
+    result.append(key.moduleName).push_back(KEY_SEPARATOR);
+    result.append(key.abilityName).push_back(KEY_SEPARATOR);
+    result.append(std::to_string(key.userId)).push_back(KEY_SEPARATOR);
+    result.append(std::to_string(key.versionCode)).push_back(KEY_SEPARATOR);
+    result.append(std::to_string(key.iconId)).push_back(KEY_SEPARATOR);
+    result.append(std::to_string(key.maxIconEdge));
+    return result;
+}
+
+bool DbmsIconCache::Get(const IconCacheKey &key, std::shared_ptr<const IconData> &icon)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto item = index_.find(KeyToString(key));
+    if (item == index_.end()) {
+        return false;
+    }
+    entries_.splice(entries_.begin(), entries_, item->second);
+    icon = item->second->icon;
+    return true;
+}
+
+void DbmsIconCache::Put(const IconCacheKey &key, const std::shared_ptr<const IconData> &icon)
+{
+    if (icon == nullptr || icon->size == 0) {
+        return;
+    }
+    size_t size = icon->type.size() + icon->size + icon->hash.size();
+    if (size > capacity_) {
+        APP_LOGD("icon size %{public}d not cached", static_cast<int32_t>(size));
+        return;
+    }
+    std::string keyString = KeyToString(key);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto item = index_.find(keyString);
+    if (item != index_.end()) {
+        EraseLocked(item->second);
+    }
+    while (!entries_.empty() && size_ + size > capacity_) {
+        EraseLocked(std::prev(entries_.end()));
+    }
+    entries_.push_front(IconCacheEntry { keyString, key.bundleName, icon, size });
+    index_[keyString] = entries_.begin();
+    size_ += size;
+}
+
+void DbmsIconCache::Invalidate(const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        auto current = it++;
+        if (current->bundleName == bundleName) {
+            EraseLocked(current);
+        }
+    }
+}
+
+void DbmsIconCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+    size_ = 0;
+}
+
+size_t DbmsIconCache::GetSize()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+}
+
+std::string DbmsIconCache::ComputeHash(const IconData &icon)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (char c : icon.type) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * FNV_PRIME;
+    }
+    // separate the type from the data so that moving bytes between them changes the hash
+    hash *= FNV_PRIME;
+    for (size_t i = 0; i < icon.size; ++i) {
+        hash = (hash ^ icon.data.get()[i]) * FNV_PRIME;
+    }
+    std::ostringstream stream;
+    stream << std::hex << std::setw(HASH_HEX_WIDTH) << std::setfill('0') << hash << HASH_SEPARATOR
+        << icon.size;
+    return stream.str();
+}
+
+void DbmsIconCache::EraseLocked(std::list<IconCacheEntry>::iterator it)
+{
+    size_ -= it->size;
+    index_.erase(it->key);
+    entries_.erase(it);
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbms_icon_store.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sys/stat.h>
+#include <thread>
+
+#include "app_log_wrapper.h"
+#include "distributed_bms.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+    const std::string ICON_STORE_DIR = "/data/service/el1/public/database/bundle_manager_service/dbms_icons/";
+    const std::string PATH_SEPARATOR = "/";
+    const std::string USER_SEPARATOR = "_";
+    const std::string TMP_SUFFIX = ".tmp";
+    constexpr uint32_t STORE_MAGIC = 0x53494244;  // "DBIS"
+    constexpr uint32_t STORE_VERSION = 1;
+    constexpr uint32_t MAX_STORE_RECORDS = 1024;
+    constexpr uint32_t MAX_STORE_FIELD_SIZE = 16 * 1024 * 1024;
+    constexpr mode_t STORE_DIR_MODE = 0700;
+    constexpr size_t DEFAULT_STORE_CACHE_CAPACITY = 4 * 1024 * 1024;
+
+    void WriteUint32(std::ofstream &out, uint32_t value)
+    {
+        out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    void WriteBytes(std::ofstream &out, const void *data, size_t size)
+    {
+        WriteUint32(out, static_cast<uint32_t>(size));
+        if (size > 0) {
+            out.write(reinterpret_cast<const char *>(data), size);
+        }
+    }
+
+    bool ReadUint32(std::ifstream &in, uint32_t &value)
+    {
+        return static_cast<bool>(in.read(reinterpret_cast<char *>(&value), sizeof(value)));
+    }
+
+    template<typename T>
+    bool ReadBytes(std::ifstream &in, T &value)
+    {
+        uint32_t size = 0;
+        if (!ReadUint32(in, size) || size > MAX_STORE_FIELD_SIZE) {
+            return false;
+        }
+        value.resize(size);
+        return size == 0 || static_cast<bool>(in.read(reinterpret_cast<char *>(&value[0]), size));
+    }
+
+    bool ReadIcon(std::ifstream &in, IconData &icon)
+    {
+        uint32_t size = 0;
+        if (!ReadUint32(in, size) || size > MAX_STORE_FIELD_SIZE) {
+            return false;
+        }
+        if (size == 0) {
+            return true;
+        }
+        std::shared_ptr<uint8_t> buffer(new uint8_t[size], std::default_delete<uint8_t[]>());
+        if (!in.read(reinterpret_cast<char *>(buffer.get()), size)) {
+            return false;
+        }
+        icon.data = buffer;
+        icon.size = size;
+        return true;
+    }
+}
+
+std::mutex DbmsIconStore::instanceMutex_;
+std::shared_ptr<DbmsIconStore> DbmsIconStore::instance_ = nullptr;
+
+DbmsIconStore::DbmsIconStore(const std::string &storeDir, size_t capacity)
+    : storeDir_(storeDir), capacity_(capacity)
+{
+    if (!storeDir_.empty() && storeDir_.back() != PATH_SEPARATOR.back()) {
+        storeDir_ += PATH_SEPARATOR;
+    }
+}
+
+std::shared_ptr<DbmsIconStore> DbmsIconStore::GetInstance()
+{
+    if (instance_ == nullptr) {
+        std::lock_guard<std::mutex> lock(instanceMutex_);
+        if (instance_ == nullptr) {
+            instance_ = std::make_shared<DbmsIconStore>(ICON_STORE_DIR, DEFAULT_STORE_CACHE_CAPACITY);
+        }
+    }
+    return instance_;
+}
+
+std::string DbmsIconStore::GetFilePath(const std::string &bundleName, int32_t userId) const
+{
+    return storeDir_ + std::to_string(userId) + USER_SEPARATOR + bundleName;
+}
+
+bool DbmsIconStore::Get(const std::string &bundleName, const std::string &moduleName,
+    const std::string &abilityName, int32_t userId, PrecomputedAbilityInfo &info)
+{
+    if (bundleName.empty() || bundleName.find(PATH_SEPARATOR) != std::string::npos) {
+        return false;
+    }
+    std::string path = GetFilePath(bundleName, userId);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto item = index_.find(path);
+    if (item == index_.end()) {
+        std::vector<PrecomputedAbilityInfo> infos;
+        if (!LoadFromFile(path, infos)) {
+            infos.clear();
+        }
+        PutLocked(path, std::move(infos));
+        item = index_.find(path);
+        if (item == index_.end()) {
+            APP_LOGW("precomputed infos of %{public}s exceed the capacity", bundleName.c_str());
+            return false;
+        }
+    } else {
+        entries_.splice(entries_.begin(), entries_, item->second);
+    }
+    for (const auto &precomputedInfo : item->second->infos) {
+        if (precomputedInfo.abilityName == abilityName &&
+            (moduleName.empty() || precomputedInfo.moduleName == moduleName)) {
+            info = precomputedInfo;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DbmsIconStore::Save(const std::string &bundleName, int32_t userId,
+    const std::vector<PrecomputedAbilityInfo> &infos)
+{
+    if (bundleName.empty() || bundleName.find(PATH_SEPARATOR) != std::string::npos) {
+        return false;
+    }
+    std::string path = GetFilePath(bundleName, userId);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!WriteToFile(path, infos)) {
+        APP_LOGE("save precomputed infos of %{public}s failed", bundleName.c_str());
+        auto item = index_.find(path);
+        if (item != index_.end()) {
+            EraseLocked(item->second);
+        }
+        return false;
+    }
+    PutLocked(path, infos);
+    APP_LOGI("save %{public}d precomputed infos of %{public}s", static_cast<int32_t>(infos.size()),
+        bundleName.c_str());
+    return true;
+}
+
+void DbmsIconStore::Remove(const std::string &bundleName, int32_t userId)
+{
+    if (bundleName.empty() || bundleName.find(PATH_SEPARATOR) != std::string::npos) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(taskMutex_);
+        pendingTasks_.erase(std::make_pair(bundleName, userId));
+        if (runningTask_ == std::make_pair(bundleName, userId)) {
+            runningTaskCancelled_ = true;
+        }
+    }
+    std::string path = GetFilePath(bundleName, userId);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto item = index_.find(path);
+    if (item != index_.end()) {
+        EraseLocked(item->second);
+    }
+    if (std::remove(path.c_str()) != 0) {
+        APP_LOGD("no precomputed infos of %{public}s", bundleName.c_str());
+    }
+}
+
+void DbmsIconStore::Schedule(const std::string &bundleName, int32_t userId)
+{
+    // serve nothing stale while the bundle is recomputed, the remote path falls back to the live query
+    Remove(bundleName, userId);
+    Enqueue(bundleName, userId);
+}
+
+void DbmsIconStore::Backfill(int32_t userId)
+{
+    std::thread([this, userId] {
+        std::vector<std::string> bundleNames;
+        if (!DelayedSingleton<DistributedBms>::GetInstance()->GetInstalledBundleNames(userId, bundleNames)) {
+            APP_LOGW("get installed bundles of user %{public}d failed", userId);
+            return;
+        }
+        int32_t count = 0;
+        for (const auto &bundleName : bundleNames) {
+            struct stat fileStat;
+            if (bundleName.empty() || bundleName.find(PATH_SEPARATOR) != std::string::npos ||
+                stat(GetFilePath(bundleName, userId).c_str(), &fileStat) == 0) {
+                continue;
+            }
+            Enqueue(bundleName, userId);
+            ++count;
+        }
+        APP_LOGI("backfill %{public}d bundles of user %{public}d", count, userId);
+    }).detach();
+}
+
+void DbmsIconStore::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+    size_ = 0;
+}
+
+size_t DbmsIconStore::GetSize()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+}
+
+void DbmsIconStore::Enqueue(const std::string &bundleName, int32_t userId)
+{
+    std::lock_guard<std::mutex> lock(taskMutex_);
+    auto task = std::make_pair(bundleName, userId);
+    if (!pendingTasks_.insert(task).second) {
+        return;
+    }
+    tasks_.push_back(task);
+    if (workerRunning_) {
+        return;
+    }
+    workerRunning_ = true;
+    std::thread([this] { RunPendingTasks(); }).detach();
+}
+
+void DbmsIconStore::RunPendingTasks()
+{
+    APP_LOGI("precompute start");
+    while (true) {
+        std::pair<std::string, int32_t> task;
+        {
+            std::lock_guard<std::mutex> lock(taskMutex_);
+            while (!tasks_.empty() && pendingTasks_.find(tasks_.front()) == pendingTasks_.end()) {
+                tasks_.pop_front();
+            }
+            if (tasks_.empty()) {
+                workerRunning_ = false;
+                runningTask_ = {};
+                break;
+            }
+            task = tasks_.front();
+            tasks_.pop_front();
+            pendingTasks_.erase(task);
+            runningTask_ = task;
+            runningTaskCancelled_ = false;
+        }
+        std::vector<PrecomputedAbilityInfo> infos;
+        if (!DelayedSingleton<DistributedBms>::GetInstance()->PrecomputeAbilityInfos(
+            task.first, task.second, infos)) {
+            APP_LOGW("precompute %{public}s failed", task.first.c_str());
+            continue;
+        }
+        // a Remove waits for the save, so it either cancels the task or deletes the saved file
+        std::lock_guard<std::mutex> lock(taskMutex_);
+        if (runningTaskCancelled_) {
+            APP_LOGI("%{public}s changed while precomputing", task.first.c_str());
+            continue;
+        }
+        Save(task.first, task.second, infos);
+    }
+    APP_LOGI("precompute end");
+}
+
+size_t DbmsIconStore::GetEntrySize(const std::string &path, const std::vector<PrecomputedAbilityInfo> &infos)
+{
+    size_t size = sizeof(StoreCacheEntry) + path.size();
+    for (const auto &info : infos) {
+        size += sizeof(PrecomputedAbilityInfo) + info.moduleName.size() + info.abilityName.size() +
+            info.locale.size() + info.label.size();
+        if (info.icon != nullptr) {
+            size += info.icon->type.size() + info.icon->size + info.icon->hash.size();
+        }
+    }
+    return size;
+}
+
+void DbmsIconStore::PutLocked(const std::string &path, std::vector<PrecomputedAbilityInfo> infos)
+{
+    auto item = index_.find(path);
+    if (item != index_.end()) {
+        EraseLocked(item->second);
+    }
+    size_t size = GetEntrySize(path, infos);
+    if (size > capacity_) {
+        return;
+    }
+    while (!entries_.empty() && size_ + size > capacity_) {
+        EraseLocked(std::prev(entries_.end()));
+    }
+    entries_.push_front(StoreCacheEntry { path, std::move(infos), size });
+    index_[path] = entries_.begin();
+    size_ += size;
+}
+
+void DbmsIconStore::EraseLocked(std::list<StoreCacheEntry>::iterator it)
+{
+    size_ -= it->size;
+    index_.erase(it->path);
+    entries_.erase(it);
+}
+
+bool DbmsIconStore::LoadFromFile(const std::string &path, std::vector<PrecomputedAbilityInfo> &infos) const
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint32_t count = 0;
+    if (!ReadUint32(in, magic) || magic != STORE_MAGIC || !ReadUint32(in, version) ||
+        version != STORE_VERSION || !ReadUint32(in, count) || count > MAX_STORE_RECORDS) {
+        APP_LOGW("precomputed infos %{public}s is not supported", path.c_str());
+        return false;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        PrecomputedAbilityInfo info;
+        auto icon = std::make_shared<IconData>();
+        if (!ReadBytes(in, info.moduleName) || !ReadBytes(in, info.abilityName) ||
+            !ReadUint32(in, info.labelId) || !ReadBytes(in, info.locale) || !ReadBytes(in, info.label) ||
+            !ReadBytes(in, icon->type) || !ReadIcon(in, *icon)) {
+            APP_LOGE("precomputed infos %{public}s is corrupted", path.c_str());
+            return false;
+        }
+        if (icon->size > 0) {
+            icon->hash = DbmsIconCache::ComputeHash(*icon);
+            info.icon = icon;
+        }
+        infos.emplace_back(std::move(info));
+    }
+    return true;
+}
+
+bool DbmsIconStore::WriteToFile(const std::string &path, const std::vector<PrecomputedAbilityInfo> &infos) const
+{
+    if (mkdir(storeDir_.c_str(), STORE_DIR_MODE) != 0 && errno != EEXIST) {
+        APP_LOGE("create %{public}s failed, errno:%{public}d", storeDir_.c_str(), errno);
+        return false;
+    }
+    std::string tmpPath = path + TMP_SUFFIX;
+    {
+        std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            APP_LOGE("open %{public}s failed", tmpPath.c_str());
+            return false;
+        }
+        WriteUint32(out, STORE_MAGIC);
+        WriteUint32(out, STORE_VERSION);
+        WriteUint32(out, static_cast<uint32_t>(infos.size()));
+        for (const auto &info : infos) {
+            WriteBytes(out, info.moduleName.data(), info.moduleName.size());
+            WriteBytes(out, info.abilityName.data(), info.abilityName.size());
+            WriteUint32(out, info.labelId);
+            WriteBytes(out, info.locale.data(), info.locale.size());
+            WriteBytes(out, info.label.data(), info.label.size());
+            const std::string &type = info.icon == nullptr ? "" : info.icon->type;
+            WriteBytes(out, type.data(), type.size());
+            WriteBytes(out, info.icon == nullptr ? nullptr : info.icon->data.get(),
+                info.icon == nullptr ? 0 : info.icon->size);
+        }
+        out.flush();
+        if (!out.good()) {
+            APP_LOGE("write %{public}s failed", tmpPath.c_str());
+            out.close();
+            std::remove(tmpPath.c_str());
+            return false;
+        }
+    }
+    // readers only ever see a complete file
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        APP_LOGE("rename %{public}s failed, errno:%{public}d", tmpPath.c_str(), errno);
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
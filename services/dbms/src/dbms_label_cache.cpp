@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbms_label_cache.h"
+
+#include <iterator>
+
+#include "app_log_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+    constexpr size_t DEFAULT_LABEL_CACHE_CAPACITY = 4096;
+    constexpr char KEY_SEPARATOR = '/';
+    constexpr size_t KEY_NUMBER_RESERVE = 24;
+    // print the counters once per this many lookups
+    constexpr uint64_t STATISTICS_INTERVAL = 1024;
+}
+
+std::mutex DbmsLabelCache::instanceMutex_;
+std::shared_ptr<DbmsLabelCache> DbmsLabelCache::instance_ = nullptr;
+
+DbmsLabelCache::DbmsLabelCache(size_t capacity) : capacity_(capacity)
+{
+}
+
+std::shared_ptr<DbmsLabelCache> DbmsLabelCache::GetInstance()
+{
+    if (instance_ == nullptr) {
+        std::lock_guard<std::mutex> lock(instanceMutex_);
+        if (instance_ == nullptr) {
+            instance_ = std::make_shared<DbmsLabelCache>(DEFAULT_LABEL_CACHE_CAPACITY);
+        }
+    }
+    return instance_;
+}
+
+std::string DbmsLabelCache::KeyToString(const LabelCacheKey &key)
+{
+    std::string result;
+    result.reserve(key.bundleName.size() + key.moduleName.size() + key.localeInfo.size() + KEY_NUMBER_RESERVE);
+    result.append(key.bundleName).push_back(KEY_SEPARATOR);
+    result.append(key.moduleName).push_back(KEY_SEPARATOR);
+    result.append(std::to_string(key.labelId)).push_back(KEY_SEPARATOR);
+    result.append(key.localeInfo).push_back(KEY_SEPARATOR);
+    result.append(std::to_string(key.userId));
+    return result;
+}
+
+bool DbmsLabelCache::Get(const LabelCacheKey &key, std::string &label)
+{
+    bool hit = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto item = index_.find(KeyToString(key));
+        if (item != index_.end()) {
+            entries_.splice(entries_.begin(), entries_, item->second);
+            label = item->second->label;
+            hit = true;
+        }
+    }
+    uint64_t hitCount = hit ? ++hitCount_ : hitCount_.load();
+    uint64_t missCount = hit ? missCount_.load() : ++missCount_;
+    if ((hitCount + missCount) % STATISTICS_INTERVAL == 0) {
+        APP_LOGI("label cache hit:%{public}llu miss:%{public}llu", static_cast<unsigned long long>(hitCount),
+            static_cast<unsigned long long>(missCount));
+    }
+    return hit;
+}
+
+void DbmsLabelCache::Put(const LabelCacheKey &key, const std::string &label)
+{
+    if (label.empty() || capacity_ == 0) {
+        return;
+    }
+    std::string keyString = KeyToString(key);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto item = index_.find(keyString);
+    if (item != index_.end()) {
+        EraseLocked(item->second);
+    }
+    while (!entries_.empty() && entries_.size() >= capacity_) {
+        EraseLocked(std::prev(entries_.end()));
+    }
+    entries_.push_front(LabelCacheEntry { keyString, key.bundleName, label });
+    index_[keyString] = entries_.begin();
+}
+
+void DbmsLabelCache::Invalidate(const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        auto current = it++;
+        if (current->bundleName == bundleName) {
+            EraseLocked(current);
+        }
+    }
+}
+
+void DbmsLabelCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+}
+
+size_t DbmsLabelCache::GetCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+uint64_t DbmsLabelCache::GetHitCount() const
+{
+    return hitCount_.load();
+}
+
+uint64_t DbmsLabelCache::GetMissCount() const
+{
+    return missCount_.load();
+}
+
+void DbmsLabelCache::EraseLocked(std::list<LabelCacheEntry>::iterator it)
+{
+    index_.erase(it->key);
+    entries_.erase(it);
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbms_query_session.h"
+
+#include "app_log_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+    constexpr size_t DEFAULT_SESSION_CAPACITY = 32;
+    constexpr std::chrono::milliseconds DEFAULT_SESSION_TIMEOUT(30 * 1000);
+}
+
+std::mutex DbmsQuerySessions::instanceMutex_;
+std::shared_ptr<DbmsQuerySessions> DbmsQuerySessions::instance_ = nullptr;
+
+DbmsQuerySessions::DbmsQuerySessions(size_t capacity, std::chrono::milliseconds timeout)
+    : capacity_(capacity), timeout_(timeout)
+{
+}
+
+std::shared_ptr<DbmsQuerySessions> DbmsQuerySessions::GetInstance()
+{
+    if (instance_ == nullptr) {
+        std::lock_guard<std::mutex> lock(instanceMutex_);
+        if (instance_ == nullptr) {
+            instance_ = std::make_shared<DbmsQuerySessions>(DEFAULT_SESSION_CAPACITY, DEFAULT_SESSION_TIMEOUT);
+        }
+    }
+    return instance_;
+}
+
+uint64_t DbmsQuerySessions::Put(uint64_t token, const std::shared_ptr<DbmsQuerySession> &session)
+{
+    if (session == nullptr || capacity_ == 0) {
+        return 0;
+    }
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(mutex_);
+    RemoveExpiredLocked(now);
+    if (token == 0) {
+        token = nextToken_++;
+        if (nextToken_ == 0) {
+            nextToken_ = 1;
+        }
+    }
+    while (sessions_.size() >= capacity_) {
+        auto oldest = sessions_.begin();
+        for (auto it = sessions_.begin(); it != sessions_.end(); ++it) {
+            if (it->second.lastAccess < oldest->second.lastAccess) {
+                oldest = it;
+            }
+        }
+        APP_LOGW("too many query sessions, drop %{public}llu", static_cast<unsigned long long>(oldest->first));
+        sessions_.erase(oldest);
+    }
+    sessions_[token] = SessionEntry { session, now };
+    return token;
+}
+
+std::shared_ptr<DbmsQuerySession> DbmsQuerySessions::Take(uint64_t token, uint32_t callerTokenId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    RemoveExpiredLocked(std::chrono::steady_clock::now());
+    auto item = sessions_.find(token);
+    if (item == sessions_.end() || item->second.session->callerTokenId != callerTokenId) {
+        APP_LOGE("query session %{public}llu not found", static_cast<unsigned long long>(token));
+        return nullptr;
+    }
+    auto session = item->second.session;
+    sessions_.erase(item);
+    return session;
+}
+
+void DbmsQuerySessions::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    sessions_.clear();
+}
+
+size_t DbmsQuerySessions::GetCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return sessions_.size();
+}
+
+void DbmsQuerySessions::RemoveExpiredLocked(std::chrono::steady_clock::time_point now)
+{
+    for (auto it = sessions_.begin(); it != sessions_.end();) {
+        if (now - it->second.lastAccess > timeout_) {
+            APP_LOGI("query session %{public}llu expired", static_cast<unsigned long long>(it->first));
+            it = sessions_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
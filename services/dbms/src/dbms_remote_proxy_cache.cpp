@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbms_remote_proxy_cache.h"
+
+#include "app_log_wrapper.h"
+#include "iservice_registry.h"
+#include "system_ability_definition.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+std::mutex DbmsRemoteProxyCache::instanceMutex_;
+std::shared_ptr<DbmsRemoteProxyCache> DbmsRemoteProxyCache::instance_ = nullptr;
+
+std::shared_ptr<DbmsRemoteProxyCache> DbmsRemoteProxyCache::GetInstance()
+{
+    if (instance_ == nullptr) {
+        std::lock_guard<std::mutex> lock(instanceMutex_);
+        if (instance_ == nullptr) {
+            instance_ = std::make_shared<DbmsRemoteProxyCache>();
+        }
+    }
+    return instance_;
+}
+
+void DbmsRemoteProxyCache::RemoteDeathRecipient::OnRemoteDied(const wptr<IRemoteObject> &remote)
+{
+    APP_LOGI("remote d-bms died");
+    DbmsRemoteProxyCache::GetInstance()->RemoveDead(deviceId_, remote.promote());
+}
+
+sptr<IDistributedBms> DbmsRemoteProxyCache::Get(const std::string &deviceId)
+{
+    if (deviceId.empty()) {
+        APP_LOGW("GetDistributedBundleMgr deviceId is empty");
+        return nullptr;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto item = proxies_.find(deviceId);
+        if (item != proxies_.end()) {
+            return item->second.proxy;
+        }
+    }
+    auto samgr = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
+    if (samgr == nullptr) {
+        APP_LOGE("GetSystemAbilityManager failed");
+        return nullptr;
+    }
+    APP_LOGI("GetDistributedBundleMgr get remote d-bms");
+    // queried without the lock, a slow device does not hold up the queries of the others
+    sptr<IRemoteObject> remoteObject = samgr->CheckSystemAbility(DISTRIBUTED_BUNDLE_MGR_SERVICE_SYS_ABILITY_ID,
+        deviceId);
+    if (remoteObject == nullptr) {
+        return nullptr;
+    }
+    return Put(deviceId, iface_cast<IDistributedBms>(remoteObject));
+}
+
+sptr<IDistributedBms> DbmsRemoteProxyCache::Put(const std::string &deviceId, const sptr<IDistributedBms> &proxy)
+{
+    if (proxy == nullptr || proxy->AsObject() == nullptr) {
+        return proxy;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto item = proxies_.find(deviceId);
+    if (item != proxies_.end()) {
+        return item->second.proxy;
+    }
+    sptr<IRemoteObject::DeathRecipient> recipient = new (std::nothrow) RemoteDeathRecipient(deviceId);
+    if (recipient == nullptr || !proxy->AsObject()->AddDeathRecipient(recipient)) {
+        // a proxy whose death can not be observed is used once and never cached
+        APP_LOGW("add death recipient failed");
+        return proxy;
+    }
+    proxies_.emplace(deviceId, ProxyEntry { proxy, recipient });
+    return proxy;
+}
+
+bool DbmsRemoteProxyCache::IsAlive(const std::string &deviceId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return proxies_.find(deviceId) != proxies_.end();
+}
+
+void DbmsRemoteProxyCache::Remove(const std::string &deviceId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto item = proxies_.find(deviceId);
+    if (item == proxies_.end()) {
+        return;
+    }
+    RemoveRecipient(item->second);
+    proxies_.erase(item);
+}
+
+void DbmsRemoteProxyCache::RemoveDead(const std::string &deviceId, const sptr<IRemoteObject> &remote)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto item = proxies_.find(deviceId);
+    if (item == proxies_.end() || (remote != nullptr && item->second.proxy->AsObject() != remote)) {
+        return;
+    }
+    RemoveRecipient(item->second);
+    proxies_.erase(item);
+}
+
+void DbmsRemoteProxyCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &item : proxies_) {
+        RemoveRecipient(item.second);
+    }
+    proxies_.clear();
+}
+
+size_t DbmsRemoteProxyCache::GetCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return proxies_.size();
+}
+
+void DbmsRemoteProxyCache::RemoveRecipient(const ProxyEntry &entry)
+{
+    auto remoteObject = entry.proxy->AsObject();
+    if (remoteObject != nullptr) {
+        remoteObject->RemoveDeathRecipient(entry.recipient);
+    }
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
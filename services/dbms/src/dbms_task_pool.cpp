@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbms_task_pool.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "app_log_wrapper.h"
+#include "distributed_bms_deadline.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+    // a batch holds at most 10 elements and each of them mostly waits on bms ipc, so nine helpers and the
+    // calling ipc thread resolve a full batch at once; concurrent batches share the helpers
+    constexpr size_t DEFAULT_THREAD_NUM = 9;
+    // an asynchronous query may wait on a remote device until its deadline, later ones are rejected
+    constexpr size_t ASYNC_THREAD_NUM = 3;
+    constexpr size_t MAX_ASYNC_POSTED_NUM = 32;
+
+    struct ParallelForState {
+        explicit ParallelForState(size_t taskCount, const std::function<void(size_t)> &taskFunc)
+            : count(taskCount), task(taskFunc) {}
+
+        // claim indexes until none is left, returns how many were run
+        size_t Run()
+        {
+            size_t runCount = 0;
+            for (size_t index = next.fetch_add(1); index < count; index = next.fetch_add(1)) {
+                task(index);
+                runCount++;
+            }
+            return runCount;
+        }
+
+        void Finish(size_t runCount)
+        {
+            if (runCount == 0) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            finished += runCount;
+            if (finished == count) {
+                condition.notify_one();
+            }
+        }
+
+        const size_t count;
+        const std::function<void(size_t)> task;
+        std::atomic<size_t> next {0};
+        std::mutex mutex;
+        std::condition_variable condition;
+        size_t finished = 0;
+    };
+}
+
+std::mutex DbmsTaskPool::instanceMutex_;
+std::shared_ptr<DbmsTaskPool> DbmsTaskPool::instance_ = nullptr;
+std::shared_ptr<DbmsTaskPool> DbmsTaskPool::asyncInstance_ = nullptr;
+
+DbmsTaskPool::DbmsTaskPool(size_t threadNum, size_t maxPostedNum)
+    : threadNum_(threadNum), maxPostedNum_(maxPostedNum)
+{
+}
+
+DbmsTaskPool::~DbmsTaskPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    condition_.notify_all();
+    for (auto &worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+std::shared_ptr<DbmsTaskPool> DbmsTaskPool::GetInstance()
+{
+    if (instance_ == nullptr) {
+        std::lock_guard<std::mutex> lock(instanceMutex_);
+        if (instance_ == nullptr) {
+            instance_ = std::make_shared<DbmsTaskPool>(DEFAULT_THREAD_NUM);
+        }
+    }
+    return instance_;
+}
+
+std::shared_ptr<DbmsTaskPool> DbmsTaskPool::GetAsyncInstance()
+{
+    if (asyncInstance_ == nullptr) {
+        std::lock_guard<std::mutex> lock(instanceMutex_);
+        if (asyncInstance_ == nullptr) {
+            asyncInstance_ = std::make_shared<DbmsTaskPool>(ASYNC_THREAD_NUM, MAX_ASYNC_POSTED_NUM);
+        }
+    }
+    return asyncInstance_;
+}
+
+size_t DbmsTaskPool::GetThreadNum() const
+{
+    return threadNum_;
+}
+
+void DbmsTaskPool::ParallelFor(size_t count, const std::function<void(size_t)> &task)
+{
+    if (count == 0) {
+        return;
+    }
+    size_t helperNum = std::min(count - 1, threadNum_);
+    if (helperNum == 0) {
+        for (size_t index = 0; index < count; ++index) {
+            task(index);
+        }
+        return;
+    }
+    // helpers that start after the batch is done find no index left, so they only keep the state alive
+    auto state = std::make_shared<ParallelForState>(count, task);
+    // helpers work for the query of the calling thread, so they keep to its deadline
+    auto deadline = DistributedBmsDeadline::GetDeadline();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        StartLocked();
+        for (size_t i = 0; i < helperNum; ++i) {
+            tasks_.emplace_back([state, deadline] {
+                DistributedBmsDeadline helperDeadline(deadline);
+                state->Finish(state->Run());
+            });
+        }
+    }
+    condition_.notify_all();
+    state->Finish(state->Run());
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->condition.wait(lock, [&state] { return state->finished == state->count; });
+}
+
+bool DbmsTaskPool::Post(std::function<void()> task)
+{
+    if (threadNum_ == 0) {
+        task();
+        return true;
+    }
+    auto deadline = DistributedBmsDeadline::GetDeadline();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (postedNum_ >= maxPostedNum_) {
+            APP_LOGW("%{public}d posted tasks are waiting", static_cast<int32_t>(postedNum_));
+            return false;
+        }
+        StartLocked();
+        postedNum_++;
+        tasks_.emplace_back([this, task = std::move(task), deadline] {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                postedNum_--;
+            }
+            DistributedBmsDeadline taskDeadline(deadline);
+            task();
+        });
+    }
+    condition_.notify_one();
+    return true;
+}
+
+void DbmsTaskPool::StartLocked()
+{
+    if (!workers_.empty()) {
+        return;
+    }
+    APP_LOGI("start %{public}d workers", static_cast<int32_t>(threadNum_));
+    for (size_t i = 0; i < threadNum_; ++i) {
+        workers_.emplace_back([this] { WorkerLoop(); });
+    }
+}
+
+void DbmsTaskPool::WorkerLoop()
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this] { return stopped_ || !tasks_.empty(); });
+            if (stopped_ && tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -15,15 +15,31 @@
 
 #include "distributed_bms.h"
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <tuple>
 #include <vector>
 
 #include "accesstoken_kit.h"
 #include "account_manager_helper.h"
 #include "app_log_wrapper.h"
 #include "appexecfwk_errors.h"
+#include "base64_util.h"
 #include "bundle_mgr_interface.h"
 #include "bundle_mgr_proxy.h"
+#include "dbms_acl_cache.h"
+#include "dbms_acl_info_cache.h"
+#include "dbms_icon_cache.h"
+#include "dbms_icon_store.h"
+#include "dbms_label_cache.h"
+#include "dbms_remote_proxy_cache.h"
+#include "dbms_task_pool.h"
+#include "distributed_bms_callback_proxy.h"
+#include "distributed_bms_deadline.h"
 #include "distributed_bms_proxy.h"
 #include "distributed_data_storage.h"
 #include "event_report.h"
@@ -51,22 +67,340 @@ namespace {
     const unsigned int LOCAL_TIME_OUT_SECONDS = 5;
     const unsigned int REMOTE_TIME_OUT_SECONDS = 10;
 #endif
-    const uint8_t DECODE_VALUE_ONE = 1;
-    const uint8_t DECODE_VALUE_TWO = 2;
-    const uint8_t DECODE_VALUE_THREE = 3;
-    const unsigned char DECODE_VALUE_CHAR_THREE = 3;
-    const uint8_t DECODE_VALUE_FOUR = 4;
-    const uint8_t DECODE_VALUE_SIX = 6;
-    const unsigned char DECODE_VALUE_CHAR_FIFTEEN = 15;
-    const unsigned char DECODE_VALUE_CHAR_SIXTY_THREE = 63;
-    const std::vector<char> DECODE_TABLE = {
-        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
-        'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
-        'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm',
-        'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
-        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
-    };
+    // a remote query is answered or abandoned within this, the caller may set a shorter deadline
+    constexpr int64_t REMOTE_DEADLINE_MS = 10 * 1000;
     const std::string POSTFIX = "_Compress.";
+    const int32_t PRECOMPUTE_FLAGS = static_cast<int32_t>(GetBundleInfoFlag::GET_BUNDLE_INFO_WITH_ABILITY) |
+        static_cast<int32_t>(GetBundleInfoFlag::GET_BUNDLE_INFO_WITH_HAP_MODULE) |
+        static_cast<int32_t>(GetBundleInfoFlag::GET_BUNDLE_INFO_WITH_APPLICATION);
+    const std::string DATA_URI_PREFIX = "data:";
+    const std::string DATA_URI_BASE64 = ";base64,";
+    // a peer accepts at most this many elements per request, a chunk is answered with one request
+    constexpr size_t REMOTE_ABILITY_INFOS_CHUNK_SIZE = 10;
+    constexpr size_t GRANTED_ACL_CACHE_CAPACITY = 64;
+    constexpr std::chrono::milliseconds GRANTED_ACL_CACHE_TTL(5 * 1000);
+
+    std::string GetLabelById(const OHOS::sptr<IBundleMgr> &iBundleMgr, const std::string &bundleName,
+        const std::string &moduleName, uint32_t labelId, int32_t userId, const std::string &localeInfo)
+    {
+        LabelCacheKey key;
+        key.bundleName = bundleName;
+        key.moduleName = moduleName;
+        key.labelId = labelId;
+        // an empty locale is resolved with the system locale, which may change while the label is cached
+        key.localeInfo = localeInfo.empty() ? Global::I18n::LocaleConfig::GetSystemLocale() : localeInfo;
+        key.userId = userId;
+        auto labelCache = DbmsLabelCache::GetInstance();
+        std::string label;
+        if (labelCache->Get(key, label)) {
+            return label;
+        }
+        label = iBundleMgr->GetStringById(bundleName, moduleName, labelId, userId, localeInfo);
+        labelCache->Put(key, label);
+        return label;
+    }
+
+    bool ParseDataUri(const std::string &uri, std::string &type, std::vector<uint8_t> &data)
+    {
+        if (uri.compare(0, DATA_URI_PREFIX.size(), DATA_URI_PREFIX) != 0) {
+            return false;
+        }
+        size_t pos = uri.find(DATA_URI_BASE64, DATA_URI_PREFIX.size());
+        if (pos == std::string::npos) {
+            return false;
+        }
+        type = uri.substr(DATA_URI_PREFIX.size(), pos - DATA_URI_PREFIX.size());
+        size_t payload = pos + DATA_URI_BASE64.size();
+        return Base64Util::Decode(uri.data() + payload, uri.size() - payload, data);
+    }
+
+    int64_t ToMicroseconds(std::chrono::steady_clock::duration duration)
+    {
+        return static_cast<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+    }
+
+    // tells how much of a remote query is spent building the acl info before the remote call is made
+    void LogRemoteLatency(const char *name, std::chrono::steady_clock::time_point beginTime,
+        std::chrono::steady_clock::duration preludeTime)
+    {
+        APP_LOGI("%{public}s cost %{public}lld us, acl info prelude %{public}lld us", name,
+            static_cast<long long>(ToMicroseconds(std::chrono::steady_clock::now() - beginTime)),
+            static_cast<long long>(ToMicroseconds(preludeTime)));
+    }
+
+    // group the elements by device, devices keep the order they first appear in
+    std::vector<RemoteDeviceGroup> GroupByDevice(const std::vector<ElementName> &elementNames)
+    {
+        std::vector<RemoteDeviceGroup> groups;
+        std::map<std::string, size_t> groupIndexes;
+        for (size_t i = 0; i < elementNames.size(); ++i) {
+            std::string deviceId = elementNames[i].GetDeviceID();
+            auto item = groupIndexes.emplace(deviceId, groups.size());
+            if (item.second) {
+                groups.emplace_back();
+                groups.back().deviceId = deviceId;
+            }
+            RemoteDeviceGroup &group = groups[item.first->second];
+            group.indexes.emplace_back(i);
+            group.elementNames.emplace_back(elementNames[i]);
+        }
+        return groups;
+    }
+
+    /**
+     * build the result of every element from its resolved label and icon and hand them back in input order,
+     * the error of the first failed element is returned
+     */
+    template<typename T>
+    int32_t BuildInOrder(const std::vector<ElementName> &elementNames, std::vector<AbilityLabelAndIcon> &resolved,
+        std::vector<T> &results, const std::function<int32_t(size_t, AbilityLabelAndIcon &, T &)> &builder)
+    {
+        std::vector<T> infos(elementNames.size());
+        for (size_t i = 0; i < elementNames.size(); ++i) {
+            int32_t result = resolved[i].result;
+            if (result == OHOS::NO_ERROR) {
+                result = builder(i, resolved[i], infos[i]);
+            }
+            if (result != OHOS::NO_ERROR) {
+                APP_LOGE("get AbilityInfo:%{public}s, %{public}s, %{public}s failed",
+                    elementNames[i].GetBundleName().c_str(), elementNames[i].GetModuleName().c_str(),
+                    elementNames[i].GetAbilityName().c_str());
+                return result;
+            }
+        }
+        results.insert(results.end(), std::make_move_iterator(infos.begin()), std::make_move_iterator(infos.end()));
+        return OHOS::NO_ERROR;
+    }
+
+    // an element the remote d-bms could never resolve fails on its own instead of failing the batch
+    int32_t CheckElementName(const ElementName &elementName)
+    {
+        if (elementName.GetBundleName().empty()) {
+            return ERR_BUNDLE_MANAGER_BUNDLE_NOT_EXIST;
+        }
+        if (elementName.GetAbilityName().empty()) {
+            return ERR_BUNDLE_MANAGER_ABILITY_NOT_EXIST;
+        }
+        return OHOS::NO_ERROR;
+    }
+
+    // a peer that does not know the options returns every field
+    void StripUnselectedFields(const RemoteAbilityInfoOptions &options, RemoteAbilityInfo &remoteAbilityInfo)
+    {
+        if (!options.HasLabel()) {
+            remoteAbilityInfo.label.clear();
+        }
+        if (!options.HasIcon()) {
+            remoteAbilityInfo.icon.clear();
+        }
+    }
+
+    // a label or an icon shared by the elements of one bundle, loaded once for all of them
+    struct BatchResource {
+        bool isIcon = false;
+        std::string bundleName;
+        std::string moduleName;
+        uint32_t resourceId = 0;
+        AbilityInfo abilityInfo;
+        std::vector<size_t> indexes;
+        std::string label;
+        std::shared_ptr<const IconData> iconData;
+        int32_t result = OHOS::NO_ERROR;
+    };
+
+    struct BatchPlan {
+        std::vector<BatchResource> resources;
+        std::map<std::tuple<bool, std::string, std::string, uint32_t>, size_t> resourceIndexes;
+        // elements resolved on their own, for single element bundles and anything the bundle info cannot serve
+        std::vector<size_t> fallbackIndexes;
+        std::vector<bool> precomputed;
+    };
+
+    BatchResource &AddBatchResource(BatchPlan &plan, bool isIcon, const std::string &bundleName,
+        const std::string &moduleName, uint32_t resourceId, size_t elementIndex)
+    {
+        auto key = std::make_tuple(isIcon, bundleName, moduleName, resourceId);
+        auto item = plan.resourceIndexes.find(key);
+        if (item == plan.resourceIndexes.end()) {
+            BatchResource resource;
+            resource.isIcon = isIcon;
+            resource.bundleName = bundleName;
+            resource.moduleName = moduleName;
+            resource.resourceId = resourceId;
+            plan.resources.emplace_back(std::move(resource));
+            item = plan.resourceIndexes.emplace(key, plan.resources.size() - 1).first;
+        }
+        BatchResource &resource = plan.resources[item->second];
+        resource.indexes.emplace_back(elementIndex);
+        return resource;
+    }
+
+    const AbilityInfo *FindAbilityInfo(const BundleInfo &bundleInfo, const ElementName &elementName)
+    {
+        for (const auto &abilityInfo : bundleInfo.abilityInfos) {
+            if (abilityInfo.name == elementName.GetAbilityName() && abilityInfo.enabled &&
+                (elementName.GetModuleName().empty() || abilityInfo.moduleName == elementName.GetModuleName())) {
+                return &abilityInfo;
+            }
+        }
+        return nullptr;
+    }
+
+    void PlanBundleResources(const BundleInfo &bundleInfo, const std::vector<ElementName> &elementNames,
+        const std::vector<size_t> &indexes, const RemoteAbilityInfoOptions &options, BatchPlan &plan)
+    {
+        for (size_t elementIndex : indexes) {
+            const AbilityInfo *abilityInfo = FindAbilityInfo(bundleInfo, elementNames[elementIndex]);
+            if (abilityInfo == nullptr) {
+                // resolved on its own to report the same error as a single query
+                plan.fallbackIndexes.emplace_back(elementIndex);
+                continue;
+            }
+            if (options.HasLabel()) {
+                AddBatchResource(plan, false, bundleInfo.name, abilityInfo->moduleName, abilityInfo->labelId,
+                    elementIndex);
+            }
+            if (!options.HasIcon()) {
+                continue;
+            }
+            BatchResource &icon = AddBatchResource(plan, true, bundleInfo.name, abilityInfo->moduleName,
+                abilityInfo->iconId, elementIndex);
+            if (icon.indexes.size() == 1) {
+                icon.abilityInfo = *abilityInfo;
+                // keep the icon cache key of the single query
+                icon.abilityInfo.applicationInfo.versionCode = bundleInfo.versionCode;
+            }
+        }
+    }
+
+    /**
+     * group the elements by bundle so a bundle costs one bundle info query, and collect the distinct labels
+     * and icons the elements need
+     */
+    void PlanBatch(const OHOS::sptr<IBundleMgr> &iBundleMgr, const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const RemoteAbilityInfoOptions &options, int32_t userId,
+        std::vector<AbilityLabelAndIcon> &results, BatchPlan &plan)
+    {
+        plan.precomputed.assign(elementNames.size(), false);
+        std::map<std::string, std::vector<size_t>> bundleIndexes;
+        auto iconStore = DbmsIconStore::GetInstance();
+        // precomputed icons are of the default size only
+        bool usePrecomputed = !options.HasIcon() || options.maxIconEdge == 0;
+        // an empty locale is the current system locale, which may differ from the one of the precomputed label
+        std::string locale = localeInfo.empty() ? Global::I18n::LocaleConfig::GetSystemLocale() : localeInfo;
+        for (size_t i = 0; i < elementNames.size(); ++i) {
+            const auto &elementName = elementNames[i];
+            PrecomputedAbilityInfo info;
+            if (!usePrecomputed || !iconStore->Get(elementName.GetBundleName(), elementName.GetModuleName(),
+                elementName.GetAbilityName(), userId, info)) {
+                bundleIndexes[elementName.GetBundleName()].emplace_back(i);
+                continue;
+            }
+            plan.precomputed[i] = true;
+            if (options.HasIcon()) {
+                results[i].iconData = info.icon;
+            }
+            if (!options.HasLabel()) {
+                continue;
+            }
+            if (locale == info.locale) {
+                results[i].label = info.label;
+            } else {
+                AddBatchResource(plan, false, elementName.GetBundleName(), info.moduleName, info.labelId, i);
+            }
+        }
+        std::vector<std::pair<std::string, std::vector<size_t>>> bundles;
+        for (auto &item : bundleIndexes) {
+            if (item.second.size() == 1) {
+                // a single ability query is cheaper than the whole bundle info
+                plan.fallbackIndexes.emplace_back(item.second.front());
+            } else {
+                bundles.emplace_back(item.first, std::move(item.second));
+            }
+        }
+        std::vector<BundleInfo> bundleInfos(bundles.size());
+        std::vector<int32_t> resultCodes(bundles.size(), ERR_OK);
+        DbmsTaskPool::GetInstance()->ParallelFor(bundles.size(),
+            [&iBundleMgr, &bundles, &bundleInfos, &resultCodes, userId](size_t index) {
+                if (DistributedBmsDeadline::IsExpired()) {
+                    resultCodes[index] = ERR_DBMS_DEADLINE_EXCEEDED;
+                    return;
+                }
+                resultCodes[index] = iBundleMgr->GetBundleInfoV9(bundles[index].first, PRECOMPUTE_FLAGS,
+                    bundleInfos[index], userId);
+            });
+        for (size_t i = 0; i < bundles.size(); ++i) {
+            if (resultCodes[i] != ERR_OK) {
+                APP_LOGW("GetBundleInfo:%{public}s failed:%{public}d", bundles[i].first.c_str(), resultCodes[i]);
+                plan.fallbackIndexes.insert(plan.fallbackIndexes.end(), bundles[i].second.begin(),
+                    bundles[i].second.end());
+                continue;
+            }
+            PlanBundleResources(bundleInfos[i], elementNames, bundles[i].second, options, plan);
+        }
+    }
+
+    void AppendKeyField(std::string &key, const std::string &field)
+    {
+        // length prefixed, so no value can pass for a field boundary
+        key.append(std::to_string(field.size())).push_back(':');
+        key.append(field);
+    }
+
+    // local callers the remote devices answered within the ttl, keyed by the network id of the remote device
+    DbmsAclCache &GetGrantedAclCache()
+    {
+        static DbmsAclCache grantedAclCache(GRANTED_ACL_CACHE_CAPACITY, GRANTED_ACL_CACHE_TTL);
+        return grantedAclCache;
+    }
+
+    bool IsAclGranted(const std::vector<ElementName> &elementNames, const DistributedBmsAclInfo &info)
+    {
+        for (const auto &elementName : elementNames) {
+            bool allowed = false;
+            if (!GetGrantedAclCache().Get(elementName.GetDeviceID(), info, allowed) || !allowed) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // called by the caller that sent the query, whose own acl info the remote devices accepted
+    void GrantAcl(const std::vector<ElementName> &elementNames, const DistributedBmsAclInfo &info)
+    {
+        for (const auto &elementName : elementNames) {
+            GetGrantedAclCache().Put(elementName.GetDeviceID(), info, true);
+        }
+    }
+
+    /**
+     * callers share a query whatever app they are, but the remote acl check depends on the caller, so a caller
+     * joins the shared query only once the devices accepted its own acl info within the ttl
+     */
+    std::string BuildFlightKey(const std::vector<ElementName> &elementNames, const std::string &localeInfo,
+        const RemoteAbilityInfoOptions &options, const DistributedBmsAclInfo &info)
+    {
+        std::string key;
+        AppendKeyField(key, std::to_string(elementNames.size()));
+        for (const auto &elementName : elementNames) {
+            AppendKeyField(key, elementName.GetDeviceID());
+            AppendKeyField(key, elementName.GetBundleName());
+            AppendKeyField(key, elementName.GetModuleName());
+            AppendKeyField(key, elementName.GetAbilityName());
+        }
+        AppendKeyField(key, localeInfo);
+        AppendKeyField(key, std::to_string(options.fields));
+        AppendKeyField(key, std::to_string(options.maxIconEdge));
+        AppendKeyField(key, info.networkId);
+        AppendKeyField(key, info.accountId);
+        AppendKeyField(key, std::to_string(info.userId));
+        if (!IsAclGranted(elementNames, info)) {
+            AppendKeyField(key, std::to_string(info.tokenId));
+            AppendKeyField(key, info.pkgName);
+        }
+        return key;
+    }
+
 #ifdef HISYSEVENT_ENABLE
     DBMSEventInfo GetEventInfo(
         const std::vector<ElementName> &elements, const std::string &localeInfo, int32_t resultCode)
@@ -152,6 +486,10 @@ void DistributedBms::Init()
         matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_ADDED);
         matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED);
         matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED);
+        matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_DISTRIBUTED_ACCOUNT_LOGIN);
+        matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_DISTRIBUTED_ACCOUNT_LOGOUT);
+        matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_DISTRIBUTED_ACCOUNT_LOGOFF);
+        matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_DISTRIBUTED_ACCOUNT_TOKEN_INVALID);
         EventFwk::CommonEventSubscribeInfo subscribeInfo(matchingSkills);
         distributedSub_ = std::make_shared<DistributedMonitor>(subscribeInfo);
         EventFwk::CommonEventManager::SubscribeCommonEvent(distributedSub_);
@@ -162,6 +500,7 @@ void DistributedBms::Init()
         return;
     }
     DistributedDataStorage::GetInstance()->UpdateDistributedData(userId);
+    DbmsIconStore::GetInstance()->Backfill(userId);
 }
 
 void DistributedBms::InitDeviceManager()
@@ -225,20 +564,7 @@ bool DistributedBms::GetLocalDevice(DistributedHardware::DmDeviceInfo& dmDeviceI
 
 static OHOS::sptr<OHOS::AppExecFwk::IDistributedBms> GetDistributedBundleMgr(const std::string &deviceId)
 {
-    auto samgr = OHOS::SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
-    if (samgr == nullptr) {
-        APP_LOGE("GetSystemAbilityManager failed");
-        return nullptr;
-    }
-    OHOS::sptr<OHOS::IRemoteObject> remoteObject;
-    if (deviceId.empty()) {
-        APP_LOGW("GetDistributedBundleMgr deviceId is empty");
-        return nullptr;
-    } else {
-        APP_LOGI("GetDistributedBundleMgr get remote d-bms");
-        remoteObject = samgr->CheckSystemAbility(OHOS::DISTRIBUTED_BUNDLE_MGR_SERVICE_SYS_ABILITY_ID, deviceId);
-    }
-    return OHOS::iface_cast<IDistributedBms>(remoteObject);
+    return DbmsRemoteProxyCache::GetInstance()->Get(deviceId);
 }
 
 int32_t DistributedBms::GetRemoteAbilityInfo(
@@ -250,6 +576,7 @@ int32_t DistributedBms::GetRemoteAbilityInfo(
 int32_t DistributedBms::GetRemoteAbilityInfo(const OHOS::AppExecFwk::ElementName &elementName,
     const std::string &localeInfo, RemoteAbilityInfo &remoteAbilityInfo)
 {
+    auto beginTime = std::chrono::steady_clock::now();
     if (!VerifySystemApp()) {
         APP_LOGE("verify system app failed");
         return ERR_BUNDLE_MANAGER_SYSTEM_API_DENIED;
@@ -258,6 +585,7 @@ int32_t DistributedBms::GetRemoteAbilityInfo(const OHOS::AppExecFwk::ElementName
         APP_LOGE("verify GET_BUNDLE_INFO_PRIVILEGED failed");
         return ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
     }
+    DistributedBmsDeadline deadline(REMOTE_DEADLINE_MS);
     auto iDistBundleMgr = GetDistributedBundleMgr(elementName.GetDeviceID());
     int32_t resultCode = 0;
     if (!iDistBundleMgr) {
@@ -267,11 +595,24 @@ int32_t DistributedBms::GetRemoteAbilityInfo(const OHOS::AppExecFwk::ElementName
 #ifdef HICOLLIE_ENABLE
         int timerId = HiviewDFX::XCollie::GetInstance().SetTimer("GetRemoteAbilityInfo", REMOTE_TIME_OUT_SECONDS,
             nullptr, nullptr, HiviewDFX::XCOLLIE_FLAG_RECOVERY);
-        HiviewDFX::XCollie::GetInstance().CancelTimer(timerId);
 #endif
         APP_LOGD("GetDistributedBundleMgr get remote d-bms");
+        auto preludeBeginTime = std::chrono::steady_clock::now();
         DistributedBmsAclInfo info = BuildDistributedBmsAclInfo();
-        resultCode = iDistBundleMgr->GetAbilityInfo(elementName, localeInfo, remoteAbilityInfo, &info);
+        auto preludeTime = std::chrono::steady_clock::now() - preludeBeginTime;
+        std::string key = BuildFlightKey({ elementName }, localeInfo, RemoteAbilityInfoOptions(), info);
+        resultCode = abilityInfoFlight_.Do(key,
+            [&iDistBundleMgr, &elementName, &localeInfo, &info](RemoteAbilityInfo &result) {
+                int32_t ret = iDistBundleMgr->GetAbilityInfo(elementName, localeInfo, result, &info);
+                if (ret == OHOS::NO_ERROR) {
+                    GrantAcl({ elementName }, info);
+                }
+                return ret;
+            }, remoteAbilityInfo);
+#ifdef HICOLLIE_ENABLE
+        HiviewDFX::XCollie::GetInstance().CancelTimer(timerId);
+#endif
+        LogRemoteLatency("GetRemoteAbilityInfo", beginTime, preludeTime);
     }
 
 #ifdef HISYSEVENT_ENABLE
@@ -290,6 +631,7 @@ int32_t DistributedBms::GetRemoteAbilityInfos(
 int32_t DistributedBms::GetRemoteAbilityInfos(const std::vector<ElementName> &elementNames,
     const std::string &localeInfo, std::vector<RemoteAbilityInfo> &remoteAbilityInfos)
 {
+    auto beginTime = std::chrono::steady_clock::now();
     if (!VerifySystemApp()) {
         APP_LOGE("verify system app failed");
         return ERR_BUNDLE_MANAGER_SYSTEM_API_DENIED;
@@ -302,21 +644,272 @@ int32_t DistributedBms::GetRemoteAbilityInfos(const std::vector<ElementName> &el
         APP_LOGE("GetDistributedBundle failed due to elementNames empty");
         return ERR_BUNDLE_MANAGER_PARAM_ERROR;
     }
+    DistributedBmsDeadline deadline(REMOTE_DEADLINE_MS);
+#ifdef HICOLLIE_ENABLE
+    int timerId = HiviewDFX::XCollie::GetInstance().SetTimer("GetRemoteAbilityInfos", REMOTE_TIME_OUT_SECONDS,
+        nullptr, nullptr, HiviewDFX::XCOLLIE_FLAG_RECOVERY);
+#endif
+    auto preludeBeginTime = std::chrono::steady_clock::now();
+    DistributedBmsAclInfo info = BuildDistributedBmsAclInfo();
+    auto preludeTime = std::chrono::steady_clock::now() - preludeBeginTime;
+    int32_t resultCode = QueryRemoteAbilityInfos(elementNames, localeInfo, info, remoteAbilityInfos);
+#ifdef HICOLLIE_ENABLE
+    HiviewDFX::XCollie::GetInstance().CancelTimer(timerId);
+#endif
+    LogRemoteLatency("GetRemoteAbilityInfos", beginTime, preludeTime);
+#ifdef HISYSEVENT_ENABLE
+    EventReport::SendSystemEvent(
+        DBMSEventType::GET_REMOTE_ABILITY_INFOS, GetEventInfo(elementNames, localeInfo, resultCode));
+#endif
+    return resultCode;
+}
+
+int32_t DistributedBms::GetRemoteAbilityInfosAsync(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const sptr<IRemoteObject> &callback)
+{
+    sptr<IDistributedBmsCallback> resultCallback = iface_cast<IDistributedBmsCallback>(callback);
+    if (resultCallback == nullptr) {
+        APP_LOGE("invalid callback");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    int32_t resultCode = ERR_OK;
+    if (!VerifySystemApp()) {
+        APP_LOGE("verify system app failed");
+        resultCode = ERR_BUNDLE_MANAGER_SYSTEM_API_DENIED;
+    } else if (!VerifyCallingPermission(Constants::PERMISSION_GET_BUNDLE_INFO_PRIVILEGED)) {
+        APP_LOGE("verify GET_BUNDLE_INFO_PRIVILEGED failed");
+        resultCode = ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
+    } else if (elementNames.empty()) {
+        APP_LOGE("GetDistributedBundle failed due to elementNames empty");
+        resultCode = ERR_BUNDLE_MANAGER_PARAM_ERROR;
+    }
+    if (resultCode != ERR_OK) {
+        resultCallback->OnRemoteAbilityInfosResult(resultCode, {});
+        return resultCode;
+    }
+    // the acl info describes the ipc caller, so it is built before the query leaves the ipc thread
+    DistributedBmsAclInfo info = BuildDistributedBmsAclInfo();
+    bool posted = DbmsTaskPool::GetAsyncInstance()->Post([this, elementNames, localeInfo, info, resultCallback] {
+        DistributedBmsDeadline deadline(REMOTE_DEADLINE_MS);
+        std::vector<RemoteAbilityInfo> remoteAbilityInfos;
+        int32_t queryResult = QueryRemoteAbilityInfos(elementNames, localeInfo, info, remoteAbilityInfos);
+#ifdef HISYSEVENT_ENABLE
+        EventReport::SendSystemEvent(
+            DBMSEventType::GET_REMOTE_ABILITY_INFOS, GetEventInfo(elementNames, localeInfo, queryResult));
+#endif
+        resultCallback->OnRemoteAbilityInfosResult(queryResult, remoteAbilityInfos);
+    });
+    if (!posted) {
+        resultCallback->OnRemoteAbilityInfosResult(ERR_DBMS_SERVICE_BUSY, {});
+        return ERR_DBMS_SERVICE_BUSY;
+    }
+    return ERR_OK;
+}
+
+int32_t DistributedBms::QueryRemoteAbilityInfos(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const DistributedBmsAclInfo &info,
+    std::vector<RemoteAbilityInfo> &remoteAbilityInfos)
+{
+    std::vector<RemoteAbilityInfo> infos;
+    int32_t resultCode = abilityInfosFlight_.Do(
+        BuildFlightKey(elementNames, localeInfo, RemoteAbilityInfoOptions(), info),
+        [this, &elementNames, &localeInfo, &info](std::vector<RemoteAbilityInfo> &result) {
+            int32_t ret = FetchRemoteAbilityInfos(elementNames, localeInfo, info, result);
+            if (ret == OHOS::NO_ERROR) {
+                GrantAcl(elementNames, info);
+            }
+            return ret;
+        }, infos);
+    if (resultCode == OHOS::NO_ERROR) {
+        remoteAbilityInfos.insert(remoteAbilityInfos.end(), std::make_move_iterator(infos.begin()),
+            std::make_move_iterator(infos.end()));
+    }
+    return resultCode;
+}
+
+int32_t DistributedBms::FetchRemoteAbilityInfos(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const DistributedBmsAclInfo &info,
+    std::vector<RemoteAbilityInfo> &remoteAbilityInfos)
+{
+    auto groups = GroupByDevice(elementNames);
+    if (groups.size() > 1) {
+        return GetRemoteAbilityInfosFromDevices(elementNames.size(), groups, localeInfo, info, remoteAbilityInfos);
+    }
+    auto iDistBundleMgr = GetDistributedBundleMgr(elementNames[0].GetDeviceID());
+    if (!iDistBundleMgr) {
+        APP_LOGE("GetDistributedBundle object failed");
+        return ERR_BUNDLE_MANAGER_DEVICE_ID_NOT_EXIST;
+    }
+    APP_LOGD("GetDistributedBundleMgr get remote d-bms");
+    DistributedBmsAclInfo remoteInfo = info;
+    return iDistBundleMgr->GetAbilityInfos(elementNames, localeInfo, remoteAbilityInfos, &remoteInfo);
+}
+
+int32_t DistributedBms::GetRemoteAbilityInfosFromDevices(size_t count, const std::vector<RemoteDeviceGroup> &groups,
+    const std::string &localeInfo, const DistributedBmsAclInfo &info,
+    std::vector<RemoteAbilityInfo> &remoteAbilityInfos)
+{
+    std::vector<int32_t> groupResults(groups.size(), OHOS::NO_ERROR);
+    std::vector<std::vector<RemoteAbilityInfo>> groupInfos(groups.size());
+    // the devices answer concurrently, so the batch takes as long as the slowest device instead of the sum
+    DbmsTaskPool::GetInstance()->ParallelFor(groups.size(),
+        [&groups, &localeInfo, &info, &groupResults, &groupInfos](size_t i) {
+            auto iDistBundleMgr = GetDistributedBundleMgr(groups[i].deviceId);
+            if (!iDistBundleMgr) {
+                APP_LOGE("GetDistributedBundle object failed");
+                groupResults[i] = ERR_BUNDLE_MANAGER_DEVICE_ID_NOT_EXIST;
+                return;
+            }
+            DistributedBmsAclInfo groupInfo = info;
+            groupResults[i] = iDistBundleMgr->GetAbilityInfos(groups[i].elementNames, localeInfo, groupInfos[i],
+                &groupInfo);
+            if (groupResults[i] == OHOS::NO_ERROR && groupInfos[i].size() != groups[i].elementNames.size()) {
+                groupResults[i] = ERR_APPEXECFWK_PARCEL_ERROR;
+            }
+        });
+    // like a single device batch, the error of the first failed element is returned
+    std::vector<RemoteAbilityInfo> infos(count);
+    size_t firstFailedIndex = count;
+    int32_t resultCode = OHOS::NO_ERROR;
+    for (size_t i = 0; i < groups.size(); ++i) {
+        if (groupResults[i] != OHOS::NO_ERROR) {
+            APP_LOGE("query %{public}d elements of a device failed:%{public}d",
+                static_cast<int32_t>(groups[i].indexes.size()), groupResults[i]);
+            if (groups[i].indexes[0] < firstFailedIndex) {
+                firstFailedIndex = groups[i].indexes[0];
+                resultCode = groupResults[i];
+            }
+            continue;
+        }
+        for (size_t j = 0; j < groups[i].indexes.size(); ++j) {
+            infos[groups[i].indexes[j]] = std::move(groupInfos[i][j]);
+        }
+    }
+    if (resultCode != OHOS::NO_ERROR) {
+        return resultCode;
+    }
+    remoteAbilityInfos.insert(remoteAbilityInfos.end(), std::make_move_iterator(infos.begin()),
+        std::make_move_iterator(infos.end()));
+    return OHOS::NO_ERROR;
+}
+
+int32_t DistributedBms::GetRemoteAbilityInfosWithBinaryIcon(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos)
+{
+    if (!VerifySystemApp()) {
+        APP_LOGE("verify system app failed");
+        return ERR_BUNDLE_MANAGER_SYSTEM_API_DENIED;
+    }
+    if (!VerifyCallingPermission(Constants::PERMISSION_GET_BUNDLE_INFO_PRIVILEGED)) {
+        APP_LOGE("verify GET_BUNDLE_INFO_PRIVILEGED failed");
+        return ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
+    }
+    if (elementNames.empty()) {
+        APP_LOGE("GetDistributedBundle failed due to elementNames empty");
+        return ERR_BUNDLE_MANAGER_PARAM_ERROR;
+    }
+    DistributedBmsDeadline deadline(REMOTE_DEADLINE_MS);
     auto iDistBundleMgr = GetDistributedBundleMgr(elementNames[0].GetDeviceID());
     int32_t resultCode = 0;
     if (!iDistBundleMgr) {
         APP_LOGE("GetDistributedBundle object failed");
         resultCode = ERR_BUNDLE_MANAGER_DEVICE_ID_NOT_EXIST;
     } else {
-#ifdef HICOLLIE_ENABLE
-        int timerId = HiviewDFX::XCollie::GetInstance().SetTimer("GetRemoteAbilityInfos", REMOTE_TIME_OUT_SECONDS,
-            nullptr, nullptr, HiviewDFX::XCOLLIE_FLAG_RECOVERY);
-        HiviewDFX::XCollie::GetInstance().CancelTimer(timerId);
+        DistributedBmsAclInfo info = BuildDistributedBmsAclInfo();
+        resultCode = iDistBundleMgr->GetAbilityInfosWithBinaryIcon(elementNames, localeInfo,
+            remoteAbilityInfos, &info);
+        if (resultCode == OHOS::IPC_STUB_UNKNOW_TRANS_ERR) {
+            // the remote d-bms predates binary icons, fetch data uris and decode them here
+            APP_LOGW("remote d-bms does not support binary icon");
+            std::vector<RemoteAbilityInfo> infos;
+            resultCode = iDistBundleMgr->GetAbilityInfos(elementNames, localeInfo, infos, &info);
+            if (resultCode == OHOS::NO_ERROR) {
+                resultCode = ConvertToBinaryInfos(infos, remoteAbilityInfos);
+            }
+        }
+    }
+#ifdef HISYSEVENT_ENABLE
+    EventReport::SendSystemEvent(
+        DBMSEventType::GET_REMOTE_ABILITY_INFOS, GetEventInfo(elementNames, localeInfo, resultCode));
 #endif
-        APP_LOGD("GetDistributedBundleMgr get remote d-bms");
+    return resultCode;
+}
+
+int32_t DistributedBms::GetRemoteAbilityInfosIfModified(const std::vector<ElementName> &elementNames,
+    const std::vector<std::string> &iconHashes, const std::string &localeInfo,
+    std::vector<RemoteAbilityConditionalInfo> &remoteAbilityInfos)
+{
+    if (!VerifySystemApp()) {
+        APP_LOGE("verify system app failed");
+        return ERR_BUNDLE_MANAGER_SYSTEM_API_DENIED;
+    }
+    if (!VerifyCallingPermission(Constants::PERMISSION_GET_BUNDLE_INFO_PRIVILEGED)) {
+        APP_LOGE("verify GET_BUNDLE_INFO_PRIVILEGED failed");
+        return ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
+    }
+    if (elementNames.empty()) {
+        APP_LOGE("GetDistributedBundle failed due to elementNames empty");
+        return ERR_BUNDLE_MANAGER_PARAM_ERROR;
+    }
+    if (!iconHashes.empty() && iconHashes.size() != elementNames.size()) {
+        APP_LOGE("iconHashes size not match elementNames");
+        return ERR_BUNDLE_MANAGER_PARAM_ERROR;
+    }
+    DistributedBmsDeadline deadline(REMOTE_DEADLINE_MS);
+    auto iDistBundleMgr = GetDistributedBundleMgr(elementNames[0].GetDeviceID());
+    int32_t resultCode = 0;
+    if (!iDistBundleMgr) {
+        APP_LOGE("GetDistributedBundle object failed");
+        resultCode = ERR_BUNDLE_MANAGER_DEVICE_ID_NOT_EXIST;
+    } else {
         DistributedBmsAclInfo info = BuildDistributedBmsAclInfo();
-        resultCode = iDistBundleMgr->GetAbilityInfos(elementNames, localeInfo, remoteAbilityInfos, &info);
+        resultCode = iDistBundleMgr->GetAbilityInfosIfModified(elementNames, iconHashes, localeInfo,
+            remoteAbilityInfos, &info);
+        if (resultCode == OHOS::IPC_STUB_UNKNOW_TRANS_ERR) {
+            // the remote d-bms predates conditional queries, every icon is sent
+            APP_LOGW("remote d-bms does not support conditional query");
+            std::vector<RemoteAbilityInfo> infos;
+            resultCode = iDistBundleMgr->GetAbilityInfos(elementNames, localeInfo, infos, &info);
+            for (auto &remoteAbilityInfo : infos) {
+                RemoteAbilityConditionalInfo conditionalInfo;
+                conditionalInfo.remoteAbilityInfo = std::move(remoteAbilityInfo);
+                remoteAbilityInfos.emplace_back(std::move(conditionalInfo));
+            }
+        }
+    }
+#ifdef HISYSEVENT_ENABLE
+    EventReport::SendSystemEvent(
+        DBMSEventType::GET_REMOTE_ABILITY_INFOS, GetEventInfo(elementNames, localeInfo, resultCode));
+#endif
+    return resultCode;
+}
+
+int32_t DistributedBms::GetRemoteAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+    std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+{
+    if (!VerifySystemApp()) {
+        APP_LOGE("verify system app failed");
+        return ERR_BUNDLE_MANAGER_SYSTEM_API_DENIED;
+    }
+    if (!VerifyCallingPermission(Constants::PERMISSION_GET_BUNDLE_INFO_PRIVILEGED)) {
+        APP_LOGE("verify GET_BUNDLE_INFO_PRIVILEGED failed");
+        return ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
     }
+    if (elementNames.empty()) {
+        APP_LOGE("GetDistributedBundle failed due to elementNames empty");
+        return ERR_BUNDLE_MANAGER_PARAM_ERROR;
+    }
+    if (!options.IsValid()) {
+        APP_LOGE("invalid options fields:%{public}u maxIconEdge:%{public}d", options.fields, options.maxIconEdge);
+        return ERR_BUNDLE_MANAGER_PARAM_ERROR;
+    }
+    DistributedBmsDeadline deadline(REMOTE_DEADLINE_MS);
+    DbmsQuerySession session;
+    session.elementNames = elementNames;
+    session.localeInfo = localeInfo;
+    session.options = options;
+    int32_t resultCode = QueryPartialChunk(session, elementNames.size(), remoteAbilityInfos);
 #ifdef HISYSEVENT_ENABLE
     EventReport::SendSystemEvent(
         DBMSEventType::GET_REMOTE_ABILITY_INFOS, GetEventInfo(elementNames, localeInfo, resultCode));
@@ -324,36 +917,242 @@ int32_t DistributedBms::GetRemoteAbilityInfos(const std::vector<ElementName> &el
     return resultCode;
 }
 
+int32_t DistributedBms::GetRemoteAbilityInfosChunked(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const RemoteAbilityInfoOptions &options, uint64_t &continuationToken,
+    std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+{
+    if (!VerifySystemApp()) {
+        APP_LOGE("verify system app failed");
+        return ERR_BUNDLE_MANAGER_SYSTEM_API_DENIED;
+    }
+    if (!VerifyCallingPermission(Constants::PERMISSION_GET_BUNDLE_INFO_PRIVILEGED)) {
+        APP_LOGE("verify GET_BUNDLE_INFO_PRIVILEGED failed");
+        return ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
+    }
+    uint64_t token = continuationToken;
+    continuationToken = 0;
+    std::shared_ptr<DbmsQuerySession> session;
+    if (token == 0) {
+        if (elementNames.empty()) {
+            APP_LOGE("GetDistributedBundle failed due to elementNames empty");
+            return ERR_BUNDLE_MANAGER_PARAM_ERROR;
+        }
+        if (!options.IsValid()) {
+            APP_LOGE("invalid options fields:%{public}u maxIconEdge:%{public}d", options.fields,
+                options.maxIconEdge);
+            return ERR_BUNDLE_MANAGER_PARAM_ERROR;
+        }
+        session = std::make_shared<DbmsQuerySession>();
+        session->callerTokenId = IPCSkeleton::GetCallingTokenID();
+        session->elementNames = elementNames;
+        session->localeInfo = localeInfo;
+        session->options = options;
+    } else {
+        session = DbmsQuerySessions::GetInstance()->Take(token, IPCSkeleton::GetCallingTokenID());
+        if (session == nullptr) {
+            return ERR_BUNDLE_MANAGER_PARAM_ERROR;
+        }
+    }
+    // every chunk is a request of its own, so it gets a deadline of its own
+    DistributedBmsDeadline deadline(REMOTE_DEADLINE_MS);
+    size_t count = std::min(REMOTE_ABILITY_INFOS_CHUNK_SIZE, session->elementNames.size() - session->nextIndex);
+    int32_t resultCode = QueryPartialChunk(*session, count, remoteAbilityInfos);
+    if (resultCode == OHOS::NO_ERROR && session->nextIndex < session->elementNames.size()) {
+        continuationToken = DbmsQuerySessions::GetInstance()->Put(token, session);
+        return resultCode;
+    }
+#ifdef HISYSEVENT_ENABLE
+    EventReport::SendSystemEvent(DBMSEventType::GET_REMOTE_ABILITY_INFOS,
+        GetEventInfo(session->elementNames, session->localeInfo, resultCode));
+#endif
+    return resultCode;
+}
+
+int32_t DistributedBms::QueryPartialChunk(DbmsQuerySession &session, size_t count,
+    std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+{
+    std::vector<RemoteAbilityInfoResult> results(count);
+    std::vector<ElementName> validElementNames;
+    std::vector<size_t> validIndexes;
+    for (size_t i = 0; i < count; ++i) {
+        const ElementName &elementName = session.elementNames[session.nextIndex + i];
+        results[i].remoteAbilityInfo.elementName = elementName;
+        results[i].resultCode = CheckElementName(elementName);
+        if (results[i].resultCode == OHOS::NO_ERROR) {
+            validElementNames.emplace_back(elementName);
+            validIndexes.emplace_back(i);
+        }
+    }
+    if (!validElementNames.empty()) {
+        if (!session.aclInfoBuilt) {
+            // built once per query, the following chunks reuse the acl info
+            session.aclInfo = BuildDistributedBmsAclInfo();
+            session.aclInfoBuilt = true;
+        }
+        auto groups = GroupByDevice(validElementNames);
+        std::vector<int32_t> groupResults(groups.size(), OHOS::NO_ERROR);
+        std::vector<std::vector<RemoteAbilityInfoResult>> groupResultInfos(groups.size());
+        auto queryGroup = [this, &session, &groups, &groupResults, &groupResultInfos](size_t i) {
+            groupResults[i] = QueryPartialFromDevice(session, groups[i].deviceId, groups[i].elementNames,
+                groupResultInfos[i]);
+        };
+        if (groups.size() == 1) {
+            queryGroup(0);
+            // a single device query keeps failing as a whole
+            if (groupResults[0] != OHOS::NO_ERROR) {
+                return groupResults[0];
+            }
+        } else {
+            DbmsTaskPool::GetInstance()->ParallelFor(groups.size(), queryGroup);
+        }
+        for (size_t i = 0; i < groups.size(); ++i) {
+            for (size_t j = 0; j < groups[i].indexes.size(); ++j) {
+                RemoteAbilityInfoResult &result = results[validIndexes[groups[i].indexes[j]]];
+                if (groupResults[i] != OHOS::NO_ERROR) {
+                    // the failure of a device is reported on each of its elements
+                    result.resultCode = groupResults[i];
+                    continue;
+                }
+                StripUnselectedFields(session.options, groupResultInfos[i][j].remoteAbilityInfo);
+                result = std::move(groupResultInfos[i][j]);
+            }
+        }
+    }
+    session.nextIndex += count;
+    remoteAbilityInfos.insert(remoteAbilityInfos.end(), std::make_move_iterator(results.begin()),
+        std::make_move_iterator(results.end()));
+    return OHOS::NO_ERROR;
+}
+
+int32_t DistributedBms::QueryPartialFromDevice(const DbmsQuerySession &session, const std::string &deviceId,
+    const std::vector<ElementName> &elementNames, std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+{
+    std::vector<RemoteAbilityInfoResult> results;
+    int32_t resultCode = partialFlight_.Do(
+        BuildFlightKey(elementNames, session.localeInfo, session.options, session.aclInfo),
+        [this, &session, &deviceId, &elementNames](std::vector<RemoteAbilityInfoResult> &result) {
+            int32_t ret = FetchPartialFromDevice(session, deviceId, elementNames, result);
+            if (ret == OHOS::NO_ERROR) {
+                GrantAcl(elementNames, session.aclInfo);
+            }
+            return ret;
+        }, results);
+    if (resultCode == OHOS::NO_ERROR) {
+        remoteAbilityInfos.insert(remoteAbilityInfos.end(), std::make_move_iterator(results.begin()),
+            std::make_move_iterator(results.end()));
+    }
+    return resultCode;
+}
+
+int32_t DistributedBms::FetchPartialFromDevice(const DbmsQuerySession &session, const std::string &deviceId,
+    const std::vector<ElementName> &elementNames, std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+{
+    auto iDistBundleMgr = GetDistributedBundleMgr(deviceId);
+    if (iDistBundleMgr == nullptr) {
+        APP_LOGE("GetDistributedBundle object failed");
+        return ERR_BUNDLE_MANAGER_DEVICE_ID_NOT_EXIST;
+    }
+    DistributedBmsAclInfo aclInfo = session.aclInfo;
+    int32_t resultCode = iDistBundleMgr->GetAbilityInfosPartial(elementNames, session.localeInfo, session.options,
+        remoteAbilityInfos, &aclInfo);
+    if (resultCode == OHOS::IPC_STUB_UNKNOW_TRANS_ERR) {
+        APP_LOGW("remote d-bms does not support partial query");
+        remoteAbilityInfos.clear();
+        resultCode = GetPartialFromOldPeer(iDistBundleMgr, elementNames, session.localeInfo, aclInfo,
+            remoteAbilityInfos);
+    }
+    if (resultCode == OHOS::NO_ERROR && remoteAbilityInfos.size() != elementNames.size()) {
+        APP_LOGE("remote d-bms returns %{public}d results of %{public}d elements",
+            static_cast<int32_t>(remoteAbilityInfos.size()), static_cast<int32_t>(elementNames.size()));
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return resultCode;
+}
+
+int32_t DistributedBms::GetPartialFromOldPeer(const sptr<IDistributedBms> &iDistBundleMgr,
+    const std::vector<ElementName> &elementNames, const std::string &localeInfo, DistributedBmsAclInfo &info,
+    std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+{
+    // the whole batch succeeds in the common case, only a failed batch is retried element by element
+    std::vector<RemoteAbilityInfo> infos;
+    int32_t resultCode = iDistBundleMgr->GetAbilityInfos(elementNames, localeInfo, infos, &info);
+    if (resultCode == OHOS::NO_ERROR && infos.size() == elementNames.size()) {
+        for (auto &remoteAbilityInfo : infos) {
+            RemoteAbilityInfoResult result;
+            result.remoteAbilityInfo = std::move(remoteAbilityInfo);
+            remoteAbilityInfos.emplace_back(std::move(result));
+        }
+        return OHOS::NO_ERROR;
+    }
+    if (resultCode == ERR_BUNDLE_MANAGER_PERMISSION_DENIED) {
+        return resultCode;
+    }
+    for (const auto &elementName : elementNames) {
+        RemoteAbilityInfoResult result;
+        result.resultCode = iDistBundleMgr->GetAbilityInfo(elementName, localeInfo, result.remoteAbilityInfo, &info);
+        result.remoteAbilityInfo.elementName = elementName;
+        remoteAbilityInfos.emplace_back(std::move(result));
+    }
+    return OHOS::NO_ERROR;
+}
+
+int32_t DistributedBms::ConvertToBinaryInfos(const std::vector<RemoteAbilityInfo> &infos,
+    std::vector<RemoteAbilityBinaryInfo> &binaryInfos)
+{
+    for (const auto &info : infos) {
+        RemoteAbilityBinaryInfo binaryInfo;
+        binaryInfo.elementName = info.elementName;
+        binaryInfo.label = info.label;
+        if (!info.icon.empty() && !ParseDataUri(info.icon, binaryInfo.iconType, binaryInfo.icon)) {
+            APP_LOGE("parse icon of %{public}s failed", info.elementName.GetAbilityName().c_str());
+            return ERR_APPEXECFWK_ENCODE_BASE64_FILE_FAILED;
+        }
+        binaryInfos.emplace_back(std::move(binaryInfo));
+    }
+    return OHOS::NO_ERROR;
+}
+
 DistributedBmsAclInfo DistributedBms::BuildDistributedBmsAclInfo()
 {
     DistributedBmsAclInfo info;
+    int32_t callingUid = IPCSkeleton::GetCallingUid();
+    int32_t userId = AccountManagerHelper::GetCurrentActiveUserId();
+    auto aclInfoCache = DbmsAclInfoCache::GetInstance();
+    if (aclInfoCache->Get(callingUid, userId, info)) {
+        return info;
+    }
     std::string accountId;
 #ifdef ACCOUNT_ENABLE
-        AccountSA::OhosAccountInfo osAccountInfo;
-        if (!AccountManagerHelper::GetOsAccountData(osAccountInfo)) {
-            APP_LOGE("GetOsAccountData failed");
-            return info;
-        }
-        accountId = osAccountInfo.uid_;
+    AccountSA::OhosAccountInfo osAccountInfo;
+    if (!AccountManagerHelper::GetOsAccountData(osAccountInfo)) {
+        APP_LOGE("GetOsAccountData failed");
+        return info;
+    }
+    accountId = osAccountInfo.uid_;
 #endif
-        DistributedHardware::DmDeviceInfo dmDeviceInfo;
-        if (!GetLocalDevice(dmDeviceInfo)) {
-            return info;
-        }
-        int32_t userId = AccountManagerHelper::GetCurrentActiveUserId();
-        auto iBundleMgr = GetBundleMgr();
-        if (!iBundleMgr) {
-            APP_LOGE("DistributedBms GetBundleMgr failed");
-            return info;
-        }
-        std::string callingBundleName;
-        iBundleMgr->GetNameForUid(IPCSkeleton::GetCallingUid(), callingBundleName);
-        info.networkId = dmDeviceInfo.networkId;
-        info.userId = userId;
-        info.accountId = accountId;
-        info.tokenId = OHOS::Security::AccessToken::AccessTokenKit::GetHapTokenID(userId, callingBundleName, 0);
-        info.pkgName = callingBundleName;
+    DistributedHardware::DmDeviceInfo dmDeviceInfo;
+    if (!GetLocalDevice(dmDeviceInfo)) {
         return info;
+    }
+    auto iBundleMgr = GetBundleMgr();
+    if (!iBundleMgr) {
+        APP_LOGE("DistributedBms GetBundleMgr failed");
+        return info;
+    }
+    std::string callingBundleName;
+    ErrCode ret = iBundleMgr->GetNameForUid(callingUid, callingBundleName);
+    info.networkId = dmDeviceInfo.networkId;
+    info.userId = userId;
+    info.accountId = accountId;
+    info.tokenId = OHOS::Security::AccessToken::AccessTokenKit::GetHapTokenID(userId, callingBundleName, 0);
+    info.pkgName = callingBundleName;
+    if (ret != ERR_OK || callingBundleName.empty() || info.tokenId == 0) {
+        APP_LOGW("acl info of uid %{public}d is incomplete, ret:%{public}d", callingUid, ret);
+        return info;
+    }
+    // only a complete acl info is cached, a failed build is retried by the next query
+    aclInfoCache->Put(callingUid, userId, info);
+    return info;
 }
 
 int32_t DistributedBms::GetAbilityInfo(
@@ -372,12 +1171,143 @@ int32_t DistributedBms::GetAbilityInfo(const OHOS::AppExecFwk::ElementName &elem
         APP_LOGE("verify permission failed");
         return ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
     }
+    return ResolveAbilityInfo(elementName, localeInfo, remoteAbilityInfo);
+}
+
+int32_t DistributedBms::ResolveAbilityInfo(const ElementName &elementName, const std::string &localeInfo,
+    RemoteAbilityInfo &remoteAbilityInfo)
+{
+    AbilityLabelAndIcon labelAndIcon;
+    int32_t ret = GetAbilityLabelAndIcon(elementName, localeInfo, labelAndIcon.label, labelAndIcon.iconData);
+    if (ret != OHOS::NO_ERROR) {
+        return ret;
+    }
+    return BuildRemoteAbilityInfo(elementName, labelAndIcon, remoteAbilityInfo);
+}
+
+int32_t DistributedBms::BuildRemoteAbilityInfo(const ElementName &elementName, AbilityLabelAndIcon &labelAndIcon,
+    RemoteAbilityInfo &remoteAbilityInfo)
+{
+    remoteAbilityInfo.elementName = elementName;
+    remoteAbilityInfo.label = std::move(labelAndIcon.label);
+    const auto &iconData = labelAndIcon.iconData;
+    if (iconData != nullptr && !GetMediaBase64(iconData->data.get(), static_cast<int64_t>(iconData->size),
+        iconData->type, remoteAbilityInfo.icon)) {
+        APP_LOGE("DistributedBms GetMediaBase64 failed");
+        return ERR_APPEXECFWK_ENCODE_BASE64_FILE_FAILED;
+    }
+    return OHOS::NO_ERROR;
+}
+
+int32_t DistributedBms::GetAbilityLabelAndIcon(const ElementName &elementName, const std::string &localeInfo,
+    std::string &label, std::shared_ptr<const IconData> &iconData, const RemoteAbilityInfoOptions &options)
+{
+    int32_t userId = AccountManagerHelper::GetCurrentActiveUserId();
+    if (userId != Constants::INVALID_USERID &&
+        GetPrecomputedAbilityInfo(elementName, localeInfo, userId, label, iconData, options)) {
+        return OHOS::NO_ERROR;
+    }
+    AbilityInfo abilityInfo;
+    int32_t ret = QueryAbilityInfoAndLabel(elementName, localeInfo, abilityInfo, userId, label,
+        options.HasLabel());
+    if (ret != OHOS::NO_ERROR || !options.HasIcon()) {
+        return ret;
+    }
+    return GetAbilityIconData(abilityInfo, userId, iconData, options.maxIconEdge);
+}
+
+void DistributedBms::BatchGetAbilityLabelAndIcon(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, std::vector<AbilityLabelAndIcon> &results, const RemoteAbilityInfoOptions &options)
+{
+    results.assign(elementNames.size(), AbilityLabelAndIcon());
+    if (DistributedBmsDeadline::IsExpired()) {
+        // nobody waits for the answer any more
+        APP_LOGW("deadline of %{public}d elements exceeded", static_cast<int32_t>(elementNames.size()));
+        for (auto &result : results) {
+            result.result = ERR_DBMS_DEADLINE_EXCEEDED;
+        }
+        return;
+    }
+    BatchPlan plan;
+    int32_t userId = AccountManagerHelper::GetCurrentActiveUserId();
+    auto iBundleMgr = GetBundleMgr();
+    if (userId == Constants::INVALID_USERID || iBundleMgr == nullptr) {
+        // every element reports its own error
+        for (size_t i = 0; i < elementNames.size(); ++i) {
+            plan.fallbackIndexes.emplace_back(i);
+        }
+    } else {
+        PlanBatch(iBundleMgr, elementNames, localeInfo, options, userId, results, plan);
+    }
+    auto resolveElement = [this, &elementNames, &localeInfo, &options, &results](size_t elementIndex) {
+        AbilityLabelAndIcon &result = results[elementIndex];
+        result.result = GetAbilityLabelAndIcon(elementNames[elementIndex], localeInfo, result.label,
+            result.iconData, options);
+    };
+    size_t resourceCount = plan.resources.size();
+    DbmsTaskPool::GetInstance()->ParallelFor(resourceCount + plan.fallbackIndexes.size(),
+        [this, &iBundleMgr, &localeInfo, &options, &plan, &resolveElement, resourceCount, userId](size_t index) {
+            if (index >= resourceCount) {
+                resolveElement(plan.fallbackIndexes[index - resourceCount]);
+                return;
+            }
+            BatchResource &resource = plan.resources[index];
+            if (DistributedBmsDeadline::IsExpired()) {
+                resource.result = ERR_DBMS_DEADLINE_EXCEEDED;
+                return;
+            }
+            if (resource.isIcon) {
+                resource.result = GetAbilityIconData(resource.abilityInfo, userId, resource.iconData,
+                    options.maxIconEdge);
+            } else {
+                resource.label = GetLabelById(iBundleMgr, resource.bundleName, resource.moduleName,
+                    resource.resourceId, userId, localeInfo);
+            }
+        });
+    std::vector<size_t> retryIndexes;
+    for (const auto &resource : plan.resources) {
+        for (size_t elementIndex : resource.indexes) {
+            AbilityLabelAndIcon &result = results[elementIndex];
+            if (resource.isIcon) {
+                // the label is checked first like in a single query, icons are after labels in the plan
+                if (result.result == OHOS::NO_ERROR) {
+                    result.result = resource.result;
+                    result.iconData = resource.iconData;
+                }
+            } else if (!resource.label.empty()) {
+                result.label = resource.label;
+            } else if (resource.result == ERR_DBMS_DEADLINE_EXCEEDED) {
+                result.result = resource.result;
+            } else if (plan.precomputed[elementIndex]) {
+                retryIndexes.emplace_back(elementIndex);
+            } else {
+                APP_LOGE("DistributedBms QueryAbilityInfo label empty");
+                result.result = ERR_APPEXECFWK_FAILED_GET_ABILITY_INFO;
+            }
+        }
+    }
+    // the precomputed label is of another locale and the locale has none, query the ability from scratch
+    DbmsTaskPool::GetInstance()->ParallelFor(retryIndexes.size(), [&retryIndexes, &resolveElement](size_t index) {
+        resolveElement(retryIndexes[index]);
+    });
+    APP_LOGD("batch of %{public}d elements resolved with %{public}d shared resources, %{public}d alone",
+        static_cast<int32_t>(elementNames.size()), static_cast<int32_t>(resourceCount),
+        static_cast<int32_t>(plan.fallbackIndexes.size() + retryIndexes.size()));
+}
+
+int32_t DistributedBms::QueryAbilityInfoAndLabel(const ElementName &elementName, const std::string &localeInfo,
+    AbilityInfo &abilityInfo, int32_t &userId, std::string &label, bool withLabel)
+{
+    if (DistributedBmsDeadline::IsExpired()) {
+        APP_LOGW("deadline exceeded before querying %{public}s", elementName.GetAbilityName().c_str());
+        return ERR_DBMS_DEADLINE_EXCEEDED;
+    }
     auto iBundleMgr = GetBundleMgr();
     if (!iBundleMgr) {
         APP_LOGE("DistributedBms GetBundleMgr failed");
         return ERR_APPEXECFWK_FAILED_SERVICE_DIED;
     }
-    int userId = AccountManagerHelper::GetCurrentActiveUserId();
+    userId = AccountManagerHelper::GetCurrentActiveUserId();
     if (userId == Constants::INVALID_USERID) {
         APP_LOGE("GetCurrentUserId failed");
         return ERR_BUNDLE_MANAGER_INVALID_USER_ID;
@@ -395,25 +1325,58 @@ int32_t DistributedBms::GetAbilityInfo(const OHOS::AppExecFwk::ElementName &elem
         APP_LOGE("DistributedBms QueryAbilityInfo abilityInfos empty");
         return ERR_APPEXECFWK_FAILED_GET_ABILITY_INFO;
     }
-    std::string label = iBundleMgr->GetStringById(
+    if (!withLabel) {
+        abilityInfo = std::move(abilityInfos[0]);
+        return OHOS::NO_ERROR;
+    }
+    label = GetLabelById(iBundleMgr,
         abilityInfos[0].bundleName, abilityInfos[0].moduleName, abilityInfos[0].labelId, userId, localeInfo);
     if (label.empty()) {
         APP_LOGE("DistributedBms QueryAbilityInfo label empty");
         return ERR_APPEXECFWK_FAILED_GET_ABILITY_INFO;
     }
-    remoteAbilityInfo.label = label;
-    remoteAbilityInfo.elementName = elementName;
-    return GetAbilityIconByContent(abilityInfos[0], userId, remoteAbilityInfo);
+    abilityInfo = std::move(abilityInfos[0]);
+    return OHOS::NO_ERROR;
 }
 
-int32_t DistributedBms::GetAbilityIconByContent(
-    const AbilityInfo &abilityInfo, int32_t userId, RemoteAbilityInfo &remoteAbilityInfo)
+int32_t DistributedBms::GetAbilityIconData(const AbilityInfo &abilityInfo, int32_t userId,
+    std::shared_ptr<const IconData> &iconData, int32_t maxIconEdge)
 {
     auto iBundleMgr = GetBundleMgr();
     if (!iBundleMgr) {
         APP_LOGE("DistributedBms GetBundleMgr failed");
         return ERR_APPEXECFWK_FAILED_SERVICE_DIED;
     }
+#ifdef DISTRIBUTED_BUNDLE_IMAGE_ENABLE
+    IconCacheKey iconKey;
+    iconKey.bundleName = abilityInfo.bundleName;
+    iconKey.moduleName = abilityInfo.moduleName;
+    iconKey.abilityName = abilityInfo.name;
+    iconKey.userId = userId;
+    iconKey.versionCode = abilityInfo.applicationInfo.versionCode;
+    iconKey.iconId = abilityInfo.iconId;
+    iconKey.maxIconEdge = maxIconEdge;
+    auto iconCache = DbmsIconCache::GetInstance();
+    if (iconCache->Get(iconKey, iconData)) {
+        APP_LOGD("icon cache hit %{public}s", abilityInfo.name.c_str());
+        return OHOS::NO_ERROR;
+    }
+    if (DistributedBmsDeadline::IsExpired()) {
+        APP_LOGW("deadline exceeded before loading icon of %{public}s", abilityInfo.name.c_str());
+        return ERR_DBMS_DEADLINE_EXCEEDED;
+    }
+    int32_t ret = LoadAbilityIcon(iBundleMgr, abilityInfo, userId, iconData, maxIconEdge);
+    if (ret != OHOS::NO_ERROR) {
+        return ret;
+    }
+    iconCache->Put(iconKey, iconData);
+#endif
+    return OHOS::NO_ERROR;
+}
+
+int32_t DistributedBms::LoadAbilityIcon(const OHOS::sptr<IBundleMgr> &iBundleMgr, const AbilityInfo &abilityInfo,
+    int32_t userId, std::shared_ptr<const IconData> &iconData, int32_t maxIconEdge)
+{
 #ifdef DISTRIBUTED_BUNDLE_IMAGE_ENABLE
     std::unique_ptr<uint8_t[]> imageContent;
     size_t imageContentSize = 0;
@@ -424,42 +1387,134 @@ int32_t DistributedBms::GetAbilityIconByContent(
         return ret;
     }
     APP_LOGD("imageContentSize is %{public}d", static_cast<int32_t>(imageContentSize));
+    if (DistributedBmsDeadline::IsExpired()) {
+        // compression is the costliest step, skip it when nobody waits for the icon
+        APP_LOGW("deadline exceeded before compressing icon of %{public}s", abilityInfo.name.c_str());
+        return ERR_DBMS_DEADLINE_EXCEEDED;
+    }
+    auto icon = std::make_shared<IconData>();
     std::unique_ptr<ImageCompress> imageCompress = std::make_unique<ImageCompress>();
-    if (imageCompress->IsImageNeedCompressBySize(imageContentSize)) {
-        std::unique_ptr<uint8_t[]> compressData;
-        int64_t compressSize = 0;
-        std::string imageType;
-        if (!imageCompress->CompressImageByContent(imageContent, imageContentSize,
-            compressData, compressSize, imageType)) {
-            return Base64WithoutCompress(imageContent, imageContentSize, remoteAbilityInfo);
-        }
-        if (!GetMediaBase64(compressData, compressSize, imageType, remoteAbilityInfo.icon)) {
-            APP_LOGE("DistributedBms GetMediaBase64 failed");
-            return ERR_APPEXECFWK_ENCODE_BASE64_FILE_FAILED;
-        }
+    std::unique_ptr<uint8_t[]> compressData;
+    int64_t compressSize = 0;
+    bool needCompress = imageCompress->IsImageNeedCompressBySize(imageContentSize);
+    if (maxIconEdge > 0) {
+        imageCompress->SetMaxEdge(maxIconEdge);
+        needCompress = needCompress || imageCompress->IsImageNeedCompressByEdge(imageContent, imageContentSize);
+    }
+    if (needCompress && imageCompress->CompressImageByContent(imageContent, imageContentSize, compressData,
+        compressSize, icon->type)) {
+        // the packing buffer is far larger than the icon, cached icons would keep it from the pool
+        icon->Assign(compressData.get(), static_cast<size_t>(compressSize));
+        imageCompress->ReleaseCompressedData(compressData);
     } else {
-        return Base64WithoutCompress(imageContent, imageContentSize, remoteAbilityInfo);
+        if (!imageCompress->GetImageTypeString(imageContent, imageContentSize, icon->type)) {
+            return ERR_APPEXECFWK_INPUT_WRONG_TYPE_FILE;
+        }
+        icon->data = std::shared_ptr<uint8_t>(imageContent.release(), std::default_delete<uint8_t[]>());
+        icon->size = imageContentSize;
     }
+    icon->hash = DbmsIconCache::ComputeHash(*icon);
+    iconData = icon;
 #endif
     return OHOS::NO_ERROR;
 }
 
-#ifdef DISTRIBUTED_BUNDLE_IMAGE_ENABLE
-int32_t DistributedBms::Base64WithoutCompress(std::unique_ptr<uint8_t[]> &imageContent, size_t imageContentSize,
-    RemoteAbilityInfo &remoteAbilityInfo)
+bool DistributedBms::GetPrecomputedAbilityInfo(const ElementName &elementName, const std::string &localeInfo,
+    int32_t userId, std::string &label, std::shared_ptr<const IconData> &iconData,
+    const RemoteAbilityInfoOptions &options)
 {
-    std::string imageType;
-    std::unique_ptr<ImageCompress> imageCompress = std::make_unique<ImageCompress>();
-    if (!imageCompress->GetImageTypeString(imageContent, imageContentSize, imageType)) {
-        return ERR_APPEXECFWK_INPUT_WRONG_TYPE_FILE;
+    if (options.HasIcon() && options.maxIconEdge > 0) {
+        // precomputed icons are of the default size only
+        return false;
     }
-    if (!GetMediaBase64(imageContent, static_cast<int64_t>(imageContentSize), imageType, remoteAbilityInfo.icon)) {
-        APP_LOGE("DistributedBms GetMediaBase64 failed");
-        return ERR_APPEXECFWK_ENCODE_BASE64_FILE_FAILED;
+    PrecomputedAbilityInfo info;
+    if (!DbmsIconStore::GetInstance()->Get(elementName.GetBundleName(), elementName.GetModuleName(),
+        elementName.GetAbilityName(), userId, info)) {
+        return false;
     }
-    return OHOS::NO_ERROR;
+    if (options.HasLabel()) {
+        // an empty locale is the current system locale, which may differ from the one of the precomputed label
+        std::string locale = localeInfo.empty() ? Global::I18n::LocaleConfig::GetSystemLocale() : localeInfo;
+        if (locale == info.locale) {
+            label = info.label;
+        } else {
+            // only the label of the precompute time locale is stored, the icon is the same for every locale
+            auto iBundleMgr = GetBundleMgr();
+            if (!iBundleMgr) {
+                APP_LOGE("DistributedBms GetBundleMgr failed");
+                return false;
+            }
+            label = GetLabelById(iBundleMgr, elementName.GetBundleName(), info.moduleName, info.labelId, userId,
+                localeInfo);
+        }
+        if (label.empty()) {
+            return false;
+        }
+    }
+    if (options.HasIcon()) {
+        iconData = info.icon;
+    }
+    APP_LOGD("precomputed hit %{public}s", elementName.GetAbilityName().c_str());
+    return true;
+}
+
+bool DistributedBms::PrecomputeAbilityInfos(const std::string &bundleName, int32_t userId,
+    std::vector<PrecomputedAbilityInfo> &infos)
+{
+    auto iBundleMgr = GetBundleMgr();
+    if (!iBundleMgr) {
+        APP_LOGE("DistributedBms GetBundleMgr failed");
+        return false;
+    }
+    BundleInfo bundleInfo;
+    if (iBundleMgr->GetBundleInfoV9(bundleName, PRECOMPUTE_FLAGS, bundleInfo, userId) != ERR_OK) {
+        APP_LOGW("GetBundleInfo:%{public}s userid:%{public}d failed", bundleName.c_str(), userId);
+        return false;
+    }
+    if (bundleInfo.singleton) {
+        return false;
+    }
+    std::string locale = Global::I18n::LocaleConfig::GetSystemLocale();
+    for (const auto &abilityInfo : bundleInfo.abilityInfos) {
+        PrecomputedAbilityInfo info;
+        info.moduleName = abilityInfo.moduleName;
+        info.abilityName = abilityInfo.name;
+        info.labelId = abilityInfo.labelId;
+        info.locale = locale;
+        info.label = iBundleMgr->GetStringById(bundleName, abilityInfo.moduleName, abilityInfo.labelId, userId, "");
+        if (info.label.empty()) {
+            APP_LOGW("no label of %{public}s", abilityInfo.name.c_str());
+            continue;
+        }
+        if (LoadAbilityIcon(iBundleMgr, abilityInfo, userId, info.icon) != OHOS::NO_ERROR) {
+            APP_LOGW("no icon of %{public}s", abilityInfo.name.c_str());
+            continue;
+        }
+        infos.emplace_back(std::move(info));
+    }
+    return true;
+}
+
+bool DistributedBms::GetInstalledBundleNames(int32_t userId, std::vector<std::string> &bundleNames)
+{
+    auto iBundleMgr = GetBundleMgr();
+    if (!iBundleMgr) {
+        APP_LOGE("DistributedBms GetBundleMgr failed");
+        return false;
+    }
+    std::vector<BundleInfo> bundleInfos;
+    if (iBundleMgr->GetBundleInfosV9(static_cast<int32_t>(GetBundleInfoFlag::GET_BUNDLE_INFO_DEFAULT), bundleInfos,
+        userId) != ERR_OK) {
+        APP_LOGW("GetBundleInfos userid:%{public}d failed", userId);
+        return false;
+    }
+    for (const auto &bundleInfo : bundleInfos) {
+        if (!bundleInfo.singleton) {
+            bundleNames.emplace_back(bundleInfo.name);
+        }
+    }
+    return true;
 }
-#endif
 
 int32_t DistributedBms::GetAbilityInfos(
     const std::vector<ElementName> &elementNames, std::vector<RemoteAbilityInfo> &remoteAbilityInfos)
@@ -477,16 +1532,116 @@ int32_t DistributedBms::GetAbilityInfos(const std::vector<ElementName> &elementN
         APP_LOGE("verify permission failed");
         return ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
     }
-    for (auto elementName : elementNames) {
-        RemoteAbilityInfo remoteAbilityInfo;
-        int32_t result = GetAbilityInfo(elementName, localeInfo, remoteAbilityInfo, info);
-        if (result) {
-            APP_LOGE("get AbilityInfo:%{public}s, %{public}s, %{public}s failed", elementName.GetBundleName().c_str(),
-                elementName.GetModuleName().c_str(), elementName.GetAbilityName().c_str());
-            return result;
+    return ResolveAbilityInfos(elementNames, localeInfo, remoteAbilityInfos);
+}
+
+int32_t DistributedBms::ResolveAbilityInfos(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, std::vector<RemoteAbilityInfo> &remoteAbilityInfos)
+{
+    std::vector<AbilityLabelAndIcon> resolved;
+    BatchGetAbilityLabelAndIcon(elementNames, localeInfo, resolved);
+    return BuildInOrder<RemoteAbilityInfo>(elementNames, resolved, remoteAbilityInfos,
+        [this, &elementNames](size_t index, AbilityLabelAndIcon &labelAndIcon,
+            RemoteAbilityInfo &remoteAbilityInfo) -> int32_t {
+            return BuildRemoteAbilityInfo(elementNames[index], labelAndIcon, remoteAbilityInfo);
+        });
+}
+
+int32_t DistributedBms::GetAbilityInfosWithBinaryIcon(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos,
+    DistributedBmsAclInfo *info)
+{
+    APP_LOGD("DistributedBms GetAbilityInfosWithBinaryIcon");
+    if (!VerifyCallingPermissionOrAclCheck(info)) {
+        APP_LOGE("verify permission failed");
+        return ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
+    }
+    std::vector<AbilityLabelAndIcon> resolved;
+    BatchGetAbilityLabelAndIcon(elementNames, localeInfo, resolved);
+    return BuildInOrder<RemoteAbilityBinaryInfo>(elementNames, resolved, remoteAbilityInfos,
+        [&elementNames](size_t index, AbilityLabelAndIcon &labelAndIcon,
+            RemoteAbilityBinaryInfo &remoteAbilityInfo) -> int32_t {
+            remoteAbilityInfo.elementName = elementNames[index];
+            remoteAbilityInfo.label = std::move(labelAndIcon.label);
+            if (labelAndIcon.iconData != nullptr) {
+                remoteAbilityInfo.iconType = labelAndIcon.iconData->type;
+                remoteAbilityInfo.icon.assign(labelAndIcon.iconData->data.get(),
+                    labelAndIcon.iconData->data.get() + labelAndIcon.iconData->size);
+            }
+            return OHOS::NO_ERROR;
+        });
+}
+
+int32_t DistributedBms::GetAbilityInfosIfModified(const std::vector<ElementName> &elementNames,
+    const std::vector<std::string> &iconHashes, const std::string &localeInfo,
+    std::vector<RemoteAbilityConditionalInfo> &remoteAbilityInfos, DistributedBmsAclInfo *info)
+{
+    APP_LOGD("DistributedBms GetAbilityInfosIfModified");
+    if (!VerifyCallingPermissionOrAclCheck(info)) {
+        APP_LOGE("verify permission failed");
+        return ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
+    }
+    if (!iconHashes.empty() && iconHashes.size() != elementNames.size()) {
+        APP_LOGE("iconHashes size not match elementNames");
+        return ERR_BUNDLE_MANAGER_PARAM_ERROR;
+    }
+    std::vector<AbilityLabelAndIcon> resolved;
+    BatchGetAbilityLabelAndIcon(elementNames, localeInfo, resolved);
+    int32_t notModifiedCount = 0;
+    int32_t ret = BuildInOrder<RemoteAbilityConditionalInfo>(elementNames, resolved, remoteAbilityInfos,
+        [this, &elementNames, &iconHashes, &notModifiedCount](size_t index, AbilityLabelAndIcon &labelAndIcon,
+            RemoteAbilityConditionalInfo &conditionalInfo) -> int32_t {
+            const auto &iconData = labelAndIcon.iconData;
+            if (iconData != nullptr && !iconHashes.empty() && !iconHashes[index].empty() &&
+                iconHashes[index] == iconData->hash) {
+                // the caller already holds this icon, only the label is sent
+                conditionalInfo.remoteAbilityInfo.elementName = elementNames[index];
+                conditionalInfo.remoteAbilityInfo.label = std::move(labelAndIcon.label);
+                conditionalInfo.iconHash = iconData->hash;
+                conditionalInfo.iconModified = false;
+                notModifiedCount++;
+                return OHOS::NO_ERROR;
+            }
+            if (iconData != nullptr) {
+                conditionalInfo.iconHash = iconData->hash;
+            }
+            return BuildRemoteAbilityInfo(elementNames[index], labelAndIcon, conditionalInfo.remoteAbilityInfo);
+        });
+    APP_LOGD("%{public}d of %{public}d icons not modified", notModifiedCount,
+        static_cast<int32_t>(elementNames.size()));
+    return ret;
+}
+
+int32_t DistributedBms::GetAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+    std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos, DistributedBmsAclInfo *info)
+{
+    APP_LOGD("DistributedBms GetAbilityInfosPartial");
+    if (!VerifyCallingPermissionOrAclCheck(info)) {
+        APP_LOGE("verify permission failed");
+        return ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
+    }
+    if (!options.IsValid()) {
+        APP_LOGE("invalid options fields:%{public}u maxIconEdge:%{public}d", options.fields, options.maxIconEdge);
+        return ERR_BUNDLE_MANAGER_PARAM_ERROR;
+    }
+    std::vector<AbilityLabelAndIcon> resolved;
+    BatchGetAbilityLabelAndIcon(elementNames, localeInfo, resolved, options);
+    int32_t failedCount = 0;
+    for (size_t i = 0; i < elementNames.size(); ++i) {
+        RemoteAbilityInfoResult result;
+        result.resultCode = resolved[i].result;
+        if (result.resultCode == OHOS::NO_ERROR) {
+            result.resultCode = BuildRemoteAbilityInfo(elementNames[i], resolved[i], result.remoteAbilityInfo);
         }
-        remoteAbilityInfos.push_back(remoteAbilityInfo);
+        if (result.resultCode != OHOS::NO_ERROR) {
+            result.remoteAbilityInfo = RemoteAbilityInfo();
+            failedCount++;
+        }
+        result.remoteAbilityInfo.elementName = elementNames[i];
+        remoteAbilityInfos.emplace_back(std::move(result));
     }
+    APP_LOGD("%{public}d of %{public}d elements failed", failedCount, static_cast<int32_t>(elementNames.size()));
     return OHOS::NO_ERROR;
 }
 
@@ -499,15 +1654,20 @@ bool DistributedBms::CheckAclData(DistributedBmsAclInfo info)
     return dbmsDeviceManager_->CheckAclData(info);
 }
 
-bool DistributedBms::GetMediaBase64(std::unique_ptr<uint8_t[]> &data, int64_t fileLength,
-    std::string &imageType, std::string &value)
+bool DistributedBms::GetMediaBase64(const uint8_t *data, int64_t fileLength,
+    const std::string &imageType, std::string &value)
 {
     if (fileLength <= 0) {
         APP_LOGE_NOFUNC("GetMediaBase64 fileLength invalid");
         return false;
     }
-    std::unique_ptr<char[]> base64Data = EncodeBase64(data, fileLength);
-    value = "data:" + imageType + ";base64," + base64Data.get();
+    size_t srcLen = static_cast<size_t>(fileLength);
+    value = "data:" + imageType + ";base64,";
+    size_t prefixLen = value.size();
+    value.resize(prefixLen + Base64Util::GetEncodedLength(srcLen));
+    // encode in place to avoid an intermediate buffer and copy
+    size_t encodedLen = Base64Util::Encode(data, srcLen, &value[prefixLen]);
+    value.resize(prefixLen + encodedLen);
     return true;
 }
 
@@ -518,8 +1678,8 @@ bool DistributedBms::GetDistributedBundleInfo(const std::string &networkId, cons
         APP_LOGE("verify GET_BUNDLE_INFO_PRIVILEGED failed");
         return ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
     }
-    if (GetDistributedBundleMgr(networkId) == nullptr) {
-        APP_LOGW_NOFUNC("remote d-bms not running");
+    if (!DbmsRemoteProxyCache::GetInstance()->IsAlive(networkId)) {
+        APP_LOGW_NOFUNC("remote d-bms not connected");
     }
 #ifdef HICOLLIE_ENABLE
     int timerId = HiviewDFX::XCollie::GetInstance().SetTimer("GetDistributedBundleInfo", LOCAL_TIME_OUT_SECONDS,
@@ -533,6 +1693,32 @@ bool DistributedBms::GetDistributedBundleInfo(const std::string &networkId, cons
     return ret;
 }
 
+int32_t DistributedBms::GetDistributedBundleInfoAsync(const std::string &networkId, const std::string &bundleName,
+    const sptr<IRemoteObject> &callback)
+{
+    sptr<IDistributedBmsCallback> resultCallback = iface_cast<IDistributedBmsCallback>(callback);
+    if (resultCallback == nullptr) {
+        APP_LOGE("invalid callback");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!VerifyCallingPermission(Constants::PERMISSION_GET_BUNDLE_INFO_PRIVILEGED)) {
+        APP_LOGE("verify GET_BUNDLE_INFO_PRIVILEGED failed");
+        resultCallback->OnDistributedBundleInfoResult(false, DistributedBundleInfo());
+        return ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
+    }
+    bool posted = DbmsTaskPool::GetAsyncInstance()->Post([networkId, bundleName, resultCallback] {
+        DistributedBundleInfo distributedBundleInfo;
+        bool ret = DistributedDataStorage::GetInstance()->GetStorageDistributeInfo(
+            networkId, bundleName, distributedBundleInfo);
+        resultCallback->OnDistributedBundleInfoResult(ret, distributedBundleInfo);
+    });
+    if (!posted) {
+        resultCallback->OnDistributedBundleInfoResult(false, DistributedBundleInfo());
+        return ERR_DBMS_SERVICE_BUSY;
+    }
+    return ERR_OK;
+}
+
 int32_t DistributedBms::GetDistributedBundleName(const std::string &networkId,  uint32_t accessTokenId,
     std::string &bundleName)
 {
@@ -540,8 +1726,8 @@ int32_t DistributedBms::GetDistributedBundleName(const std::string &networkId,
         APP_LOGE("verify calling permission failed");
         return ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
     }
-    if (GetDistributedBundleMgr(networkId) == nullptr) {
-        APP_LOGW_NOFUNC("remote d-bms not running");
+    if (!DbmsRemoteProxyCache::GetInstance()->IsAlive(networkId)) {
+        APP_LOGW_NOFUNC("remote d-bms not connected");
     }
 #ifdef HICOLLIE_ENABLE
     int timerId = HiviewDFX::XCollie::GetInstance().SetTimer("GetDistributedBundleName", LOCAL_TIME_OUT_SECONDS,
@@ -558,6 +1744,7 @@ int32_t DistributedBms::GetDistributedBundleName(const std::string &networkId,
 int32_t DistributedBms::GetRemoteBundleVersionCode(const std::string &deviceId, const std::string &bundleName,
     uint32_t &versionCode)
 {
+    auto beginTime = std::chrono::steady_clock::now();
     if (!VerifySystemApp()) {
         APP_LOGE("verify system app failed");
         return ERR_BUNDLE_MANAGER_SYSTEM_API_DENIED;
@@ -574,24 +1761,74 @@ int32_t DistributedBms::GetRemoteBundleVersionCode(const std::string &deviceId,
         APP_LOGE("bundleName is empty");
         return ERR_BUNDLE_MANAGER_BUNDLE_NOT_EXIST;
     }
-    auto iDistBundleMgr = GetDistributedBundleMgr(deviceId);
-    int32_t resultCode = 0;
-    if (!iDistBundleMgr) {
-        APP_LOGE("GetDistributedBundle object failed");
-        return ERR_BUNDLE_MANAGER_DEVICE_ID_NOT_EXIST;
-    }
 #ifdef HICOLLIE_ENABLE
     int timerId = HiviewDFX::XCollie::GetInstance().SetTimer("GetRemoteBundleVersionCode", REMOTE_TIME_OUT_SECONDS,
         nullptr, nullptr, HiviewDFX::XCOLLIE_FLAG_RECOVERY);
 #endif
+    DistributedBmsDeadline deadline(REMOTE_DEADLINE_MS);
+    auto preludeBeginTime = std::chrono::steady_clock::now();
     DistributedBmsAclInfo info = BuildDistributedBmsAclInfo();
-    resultCode = iDistBundleMgr->GetBundleVersionCode(bundleName, versionCode, info);
+    auto preludeTime = std::chrono::steady_clock::now() - preludeBeginTime;
+    int32_t resultCode = QueryRemoteBundleVersionCode(deviceId, bundleName, info, versionCode);
+    LogRemoteLatency("GetRemoteBundleVersionCode", beginTime, preludeTime);
 #ifdef HICOLLIE_ENABLE
     HiviewDFX::XCollie::GetInstance().CancelTimer(timerId);
 #endif
     return resultCode;
 }
 
+int32_t DistributedBms::GetRemoteBundleVersionCodeAsync(const std::string &deviceId, const std::string &bundleName,
+    const sptr<IRemoteObject> &callback)
+{
+    sptr<IDistributedBmsCallback> resultCallback = iface_cast<IDistributedBmsCallback>(callback);
+    if (resultCallback == nullptr) {
+        APP_LOGE("invalid callback");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    int32_t resultCode = ERR_OK;
+    if (!VerifySystemApp()) {
+        APP_LOGE("verify system app failed");
+        resultCode = ERR_BUNDLE_MANAGER_SYSTEM_API_DENIED;
+    } else if (!VerifyCallingPermission(Constants::PERMISSION_GET_BUNDLE_INFO_PRIVILEGED)) {
+        APP_LOGE("verify GET_BUNDLE_INFO_PRIVILEGED failed");
+        resultCode = ERR_BUNDLE_MANAGER_PERMISSION_DENIED;
+    } else if (deviceId.empty()) {
+        APP_LOGE("deviceId is empty");
+        resultCode = ERR_BUNDLE_MANAGER_DEVICE_ID_NOT_EXIST;
+    } else if (bundleName.empty()) {
+        APP_LOGE("bundleName is empty");
+        resultCode = ERR_BUNDLE_MANAGER_BUNDLE_NOT_EXIST;
+    }
+    if (resultCode != ERR_OK) {
+        resultCallback->OnRemoteBundleVersionCodeResult(resultCode, 0);
+        return resultCode;
+    }
+    DistributedBmsAclInfo info = BuildDistributedBmsAclInfo();
+    bool posted = DbmsTaskPool::GetAsyncInstance()->Post([this, deviceId, bundleName, info, resultCallback] {
+        DistributedBmsDeadline deadline(REMOTE_DEADLINE_MS);
+        uint32_t versionCode = 0;
+        int32_t queryResult = QueryRemoteBundleVersionCode(deviceId, bundleName, info, versionCode);
+        resultCallback->OnRemoteBundleVersionCodeResult(queryResult, versionCode);
+    });
+    if (!posted) {
+        resultCallback->OnRemoteBundleVersionCodeResult(ERR_DBMS_SERVICE_BUSY, 0);
+        return ERR_DBMS_SERVICE_BUSY;
+    }
+    return ERR_OK;
+}
+
+int32_t DistributedBms::QueryRemoteBundleVersionCode(const std::string &deviceId, const std::string &bundleName,
+    const DistributedBmsAclInfo &info, uint32_t &versionCode)
+{
+    auto iDistBundleMgr = GetDistributedBundleMgr(deviceId);
+    if (!iDistBundleMgr) {
+        APP_LOGE("GetDistributedBundle object failed");
+        return ERR_BUNDLE_MANAGER_DEVICE_ID_NOT_EXIST;
+    }
+    DistributedBmsAclInfo remoteInfo = info;
+    return iDistBundleMgr->GetBundleVersionCode(bundleName, versionCode, remoteInfo);
+}
+
 int32_t DistributedBms::GetBundleVersionCode(const std::string &bundleName, uint32_t &versionCode,
     DistributedBmsAclInfo &info)
 {
@@ -614,6 +1851,10 @@ int32_t DistributedBms::GetBundleVersionCode(const std::string &bundleName, uint
         APP_LOGE("GetCurrentUserId failed");
         return ERR_BUNDLE_MANAGER_INVALID_USER_ID;
     }
+    if (DistributedBmsDeadline::IsExpired()) {
+        APP_LOGW("deadline exceeded before querying %{public}s", bundleName.c_str());
+        return ERR_DBMS_DEADLINE_EXCEEDED;
+    }
     ApplicationInfo appInfo;
     auto ret = iBundleMgr->GetApplicationInfoV9(bundleName,
         static_cast<uint32_t>(ApplicationFlag::GET_BASIC_APPLICATION_INFO), userId, appInfo);
@@ -625,50 +1866,6 @@ int32_t DistributedBms::GetBundleVersionCode(const std::string &bundleName, uint
     return ERR_OK;
 }
 
-std::unique_ptr<char[]> DistributedBms::EncodeBase64(std::unique_ptr<uint8_t[]> &data, int srcLen)
-{
-    int len = (srcLen / DECODE_VALUE_THREE) * DECODE_VALUE_FOUR; // Split 3 bytes to 4 parts, each containing 6 bits.
-    int outLen = ((srcLen % DECODE_VALUE_THREE) != 0) ? (len + DECODE_VALUE_FOUR) : len;
-    const uint8_t *srcData = data.get();
-    std::unique_ptr<char[]>  result = std::make_unique<char[]>(outLen + DECODE_VALUE_ONE);
-    char *dstData = result.get();
-    int j = 0;
-    int i = 0;
-    for (; i < srcLen - DECODE_VALUE_THREE; i += DECODE_VALUE_THREE) {
-        unsigned char byte1 = srcData[i];
-        unsigned char byte2 = srcData[i + DECODE_VALUE_ONE];
-        unsigned char byte3 = srcData[i + DECODE_VALUE_TWO];
-        dstData[j++] = DECODE_TABLE[byte1 >> DECODE_VALUE_TWO];
-        dstData[j++] =
-            DECODE_TABLE[(static_cast<uint8_t>(byte1 & DECODE_VALUE_CHAR_THREE) << DECODE_VALUE_FOUR)
-             | (byte2 >> DECODE_VALUE_FOUR)];
-        dstData[j++] =
-            DECODE_TABLE[(static_cast<uint8_t>(byte2 & DECODE_VALUE_CHAR_FIFTEEN)
-                << DECODE_VALUE_TWO) | (byte3 >> DECODE_VALUE_SIX)];
-        dstData[j++] = DECODE_TABLE[byte3 & DECODE_VALUE_CHAR_SIXTY_THREE];
-    }
-    if (srcLen % DECODE_VALUE_THREE == DECODE_VALUE_ONE) {
-        unsigned char byte1 = srcData[i];
-        dstData[j++] = DECODE_TABLE[byte1 >> DECODE_VALUE_TWO];
-        dstData[j++] = DECODE_TABLE[static_cast<uint8_t>(byte1 & DECODE_VALUE_CHAR_THREE) << DECODE_VALUE_FOUR];
-        dstData[j++] = '=';
-        dstData[j++] = '=';
-    } else {
-        unsigned char byte1 = srcData[i];
-        unsigned char byte2 = srcData[i + DECODE_VALUE_ONE];
-        dstData[j++] = DECODE_TABLE[byte1 >> DECODE_VALUE_TWO];
-        dstData[j++] =
-            DECODE_TABLE[(static_cast<uint8_t>(byte1 & DECODE_VALUE_CHAR_THREE) << DECODE_VALUE_FOUR)
-             | (byte2 >> DECODE_VALUE_FOUR)];
-        dstData[j++] = DECODE_TABLE[static_cast<uint8_t>(byte2 & DECODE_VALUE_CHAR_FIFTEEN)
-                                    << DECODE_VALUE_TWO];
-        dstData[j++] = '=';
-    }
-    dstData[outLen] = '\0';
-
-    return result;
-}
-
 bool DistributedBms::VerifySystemApp()
 {
     APP_LOGI("verifying systemApp");
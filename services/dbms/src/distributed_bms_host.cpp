@@ -20,13 +20,17 @@
 #include "bundle_constants.h"
 #include "bundle_memory_guard.h"
 #include "dbms_scope_guard.h"
+#include "distributed_bms_callback_proxy.h"
+#include "distributed_bms_deadline.h"
 #include "distributed_bundle_ipc_interface_code.h"
+#include "ipc_skeleton.h"
 #include "remote_ability_info.h"
 
 namespace OHOS {
 namespace AppExecFwk {
 namespace {
 constexpr int32_t GET_REMOTE_ABILITY_INFO_MAX_SIZE = 10;
+constexpr int32_t GET_REMOTE_ABILITY_INFOS_CHUNKED_MAX_SIZE = 512;
 constexpr int32_t MIN_SIZE = 0;
 }
 
@@ -72,6 +76,26 @@ int DistributedBmsHost::OnRemoteRequest(uint32_t code, MessageParcel &data, Mess
             return HandleGetRemoteBundleVersionCode(data, reply);
         case static_cast<uint32_t>(DistributedInterfaceCode::GET_BUNDLE_VERSION_CODE):
             return HandleGetBundleVersionCode(data, reply);
+        case static_cast<uint32_t>(DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_WITH_BINARY_ICON):
+            return HandleGetRemoteAbilityInfosWithBinaryIcon(data, reply);
+        case static_cast<uint32_t>(DistributedInterfaceCode::GET_ABILITY_INFOS_WITH_BINARY_ICON):
+            return HandleGetAbilityInfosWithBinaryIcon(data, reply);
+        case static_cast<uint32_t>(DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_IF_MODIFIED):
+            return HandleGetRemoteAbilityInfosIfModified(data, reply);
+        case static_cast<uint32_t>(DistributedInterfaceCode::GET_ABILITY_INFOS_IF_MODIFIED):
+            return HandleGetAbilityInfosIfModified(data, reply);
+        case static_cast<uint32_t>(DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_PARTIAL):
+            return HandleGetRemoteAbilityInfosPartial(data, reply);
+        case static_cast<uint32_t>(DistributedInterfaceCode::GET_ABILITY_INFOS_PARTIAL):
+            return HandleGetAbilityInfosPartial(data, reply);
+        case static_cast<uint32_t>(DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_CHUNKED):
+            return HandleGetRemoteAbilityInfosChunked(data, reply);
+        case static_cast<uint32_t>(DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_ASYNC):
+            return HandleGetRemoteAbilityInfosAsync(data, reply);
+        case static_cast<uint32_t>(DistributedInterfaceCode::GET_REMOTE_BUNDLE_VERSION_CODE_ASYNC):
+            return HandleGetRemoteBundleVersionCodeAsync(data, reply);
+        case static_cast<uint32_t>(DistributedInterfaceCode::GET_DISTRIBUTED_BUNDLE_INFO_ASYNC):
+            return HandleGetDistributedBundleInfoAsync(data, reply);
         default:
             APP_LOGW("DistributedBmsHost receives unknown code, code = %{public}d", code);
             return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
@@ -89,6 +113,7 @@ int DistributedBmsHost::HandleGetRemoteAbilityInfo(Parcel &data, Parcel &reply)
     }
     std::string localeInfo = data.ReadString();
     RemoteAbilityInfo remoteAbilityInfo;
+    DistributedBmsDeadline deadline(DistributedBmsDeadline::ReadFromParcel(data));
     int ret = GetRemoteAbilityInfo(*elementName, localeInfo, remoteAbilityInfo);
     if (ret != NO_ERROR) {
         APP_LOGE("GetRemoteAbilityInfo result:%{public}d", ret);
@@ -115,6 +140,7 @@ int DistributedBmsHost::HandleGetRemoteAbilityInfos(Parcel &data, Parcel &reply)
     }
     std::string localeInfo = data.ReadString();
     std::vector<RemoteAbilityInfo> remoteAbilityInfos;
+    DistributedBmsDeadline deadline(DistributedBmsDeadline::ReadFromParcel(data));
     int ret = GetRemoteAbilityInfos(elementNames, localeInfo, remoteAbilityInfos);
     if (ret != NO_ERROR) {
         APP_LOGE("GetRemoteAbilityInfos result:%{public}d", ret);
@@ -157,6 +183,7 @@ int DistributedBmsHost::HandleGetAbilityInfo(Parcel &data, Parcel &reply)
         }
     }
     RemoteAbilityInfo remoteAbilityInfo;
+    DistributedBmsDeadline deadline(DistributedBmsDeadline::ReadFromParcel(data));
     int ret = GetAbilityInfo(*elementName, localeInfo, remoteAbilityInfo, info);
     if (ret != NO_ERROR) {
         APP_LOGE("GetAbilityInfo result:%{public}d", ret);
@@ -198,6 +225,7 @@ int DistributedBmsHost::HandleGetAbilityInfos(Parcel &data, Parcel &reply)
         }
     }
     std::vector<RemoteAbilityInfo> remoteAbilityInfos;
+    DistributedBmsDeadline deadline(DistributedBmsDeadline::ReadFromParcel(data));
     int ret = GetAbilityInfos(elementNames, localeInfo, remoteAbilityInfos, info);
     if (ret != NO_ERROR) {
         APP_LOGE("GetAbilityInfos result:%{public}d", ret);
@@ -256,6 +284,7 @@ int32_t DistributedBmsHost::HandleGetRemoteBundleVersionCode(Parcel &data, Parce
     std::string deviceId = data.ReadString();
     std::string bundleName = data.ReadString();
     uint32_t versionCode = 0;
+    DistributedBmsDeadline deadline(DistributedBmsDeadline::ReadFromParcel(data));
     int32_t ret = GetRemoteBundleVersionCode(deviceId, bundleName, versionCode);
     if (ret != NO_ERROR) {
         APP_LOGE("GetRemoteBundleVersionCode result:%{public}d", ret);
@@ -278,6 +307,7 @@ int32_t DistributedBmsHost::HandleGetBundleVersionCode(Parcel &data, Parcel &rep
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
     uint32_t versionCode = 0;
+    DistributedBmsDeadline deadline(DistributedBmsDeadline::ReadFromParcel(data));
     int32_t ret = GetBundleVersionCode(bundleName, versionCode, *info);
     if (ret != NO_ERROR) {
         APP_LOGE("GetBundleVersionCode result:%{public}d", ret);
@@ -290,6 +320,325 @@ int32_t DistributedBmsHost::HandleGetBundleVersionCode(Parcel &data, Parcel &rep
     return NO_ERROR;
 }
 
+int DistributedBmsHost::HandleGetRemoteAbilityInfosWithBinaryIcon(MessageParcel &data, MessageParcel &reply)
+{
+    APP_LOGI("DistributedBmsHost handle get remote ability infos with binary icon");
+    std::vector<ElementName> elementNames;
+    if (!GetParcelableInfos<ElementName>(data, elementNames)) {
+        APP_LOGE("GetRemoteAbilityInfosWithBinaryIcon get parcelable infos failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::string localeInfo = data.ReadString();
+    std::vector<RemoteAbilityBinaryInfo> remoteAbilityInfos;
+    DistributedBmsDeadline deadline(DistributedBmsDeadline::ReadFromParcel(data));
+    int ret = GetRemoteAbilityInfosWithBinaryIcon(elementNames, localeInfo, remoteAbilityInfos);
+    if (ret != NO_ERROR) {
+        APP_LOGE("GetRemoteAbilityInfosWithBinaryIcon result:%{public}d", ret);
+        return ret;
+    }
+    if (!reply.WriteBool(true) || !WriteBinaryInfos(remoteAbilityInfos, reply)) {
+        APP_LOGE("GetRemoteAbilityInfosWithBinaryIcon write failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return NO_ERROR;
+}
+
+int DistributedBmsHost::HandleGetAbilityInfosWithBinaryIcon(MessageParcel &data, MessageParcel &reply)
+{
+    APP_LOGI("DistributedBmsHost handle get ability infos with binary icon");
+    std::vector<ElementName> elementNames;
+    if (!GetParcelableInfos<ElementName>(data, elementNames)) {
+        APP_LOGE("GetAbilityInfosWithBinaryIcon get parcelable infos failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::string localeInfo = data.ReadString();
+    bool hasInfo = data.ReadBool();
+    std::unique_ptr<DistributedBmsAclInfo> info;
+    if (hasInfo) {
+        info.reset(data.ReadParcelable<DistributedBmsAclInfo>());
+        if (info == nullptr) {
+            APP_LOGE("HandleGetAbilityInfosWithBinaryIcon get parcelable info failed");
+            return ERR_APPEXECFWK_PARCEL_ERROR;
+        }
+    }
+    std::vector<RemoteAbilityBinaryInfo> remoteAbilityInfos;
+    DistributedBmsDeadline deadline(DistributedBmsDeadline::ReadFromParcel(data));
+    int ret = GetAbilityInfosWithBinaryIcon(elementNames, localeInfo, remoteAbilityInfos, info.get());
+    if (ret != NO_ERROR) {
+        APP_LOGE("GetAbilityInfosWithBinaryIcon result:%{public}d", ret);
+        return ret;
+    }
+    if (!reply.WriteBool(true) || !WriteBinaryInfos(remoteAbilityInfos, reply)) {
+        APP_LOGE("GetAbilityInfosWithBinaryIcon write failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return NO_ERROR;
+}
+
+int DistributedBmsHost::HandleGetRemoteAbilityInfosIfModified(Parcel &data, Parcel &reply)
+{
+    APP_LOGI("DistributedBmsHost handle get remote ability infos if modified");
+    std::vector<ElementName> elementNames;
+    if (!GetParcelableInfos<ElementName>(data, elementNames)) {
+        APP_LOGE("GetRemoteAbilityInfosIfModified get parcelable infos failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::vector<std::string> iconHashes;
+    if (!data.ReadStringVector(&iconHashes) || (!iconHashes.empty() && iconHashes.size() != elementNames.size())) {
+        APP_LOGE("GetRemoteAbilityInfosIfModified read iconHashes failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::string localeInfo = data.ReadString();
+    std::vector<RemoteAbilityConditionalInfo> remoteAbilityInfos;
+    DistributedBmsDeadline deadline(DistributedBmsDeadline::ReadFromParcel(data));
+    int ret = GetRemoteAbilityInfosIfModified(elementNames, iconHashes, localeInfo, remoteAbilityInfos);
+    if (ret != NO_ERROR) {
+        APP_LOGE("GetRemoteAbilityInfosIfModified result:%{public}d", ret);
+        return ret;
+    }
+    if (!reply.WriteBool(true)) {
+        APP_LOGE("GetRemoteAbilityInfosIfModified write failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!WriteParcelableVector<RemoteAbilityConditionalInfo>(remoteAbilityInfos, reply)) {
+        APP_LOGE("GetRemoteAbilityInfosIfModified write failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return NO_ERROR;
+}
+
+int DistributedBmsHost::HandleGetAbilityInfosIfModified(Parcel &data, Parcel &reply)
+{
+    APP_LOGI("DistributedBmsHost handle get ability infos if modified");
+    std::vector<ElementName> elementNames;
+    if (!GetParcelableInfos<ElementName>(data, elementNames)) {
+        APP_LOGE("GetAbilityInfosIfModified get parcelable infos failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::vector<std::string> iconHashes;
+    if (!data.ReadStringVector(&iconHashes) || (!iconHashes.empty() && iconHashes.size() != elementNames.size())) {
+        APP_LOGE("GetAbilityInfosIfModified read iconHashes failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::string localeInfo = data.ReadString();
+    bool hasInfo = data.ReadBool();
+    std::unique_ptr<DistributedBmsAclInfo> info;
+    if (hasInfo) {
+        info.reset(data.ReadParcelable<DistributedBmsAclInfo>());
+        if (info == nullptr) {
+            APP_LOGE("HandleGetAbilityInfosIfModified get parcelable info failed");
+            return ERR_APPEXECFWK_PARCEL_ERROR;
+        }
+    }
+    std::vector<RemoteAbilityConditionalInfo> remoteAbilityInfos;
+    DistributedBmsDeadline deadline(DistributedBmsDeadline::ReadFromParcel(data));
+    int ret = GetAbilityInfosIfModified(elementNames, iconHashes, localeInfo, remoteAbilityInfos, info.get());
+    if (ret != NO_ERROR) {
+        APP_LOGE("GetAbilityInfosIfModified result:%{public}d", ret);
+        return ret;
+    }
+    if (!reply.WriteBool(true)) {
+        APP_LOGE("GetAbilityInfosIfModified write failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!WriteParcelableVector<RemoteAbilityConditionalInfo>(remoteAbilityInfos, reply)) {
+        APP_LOGE("GetAbilityInfosIfModified write failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return NO_ERROR;
+}
+
+int DistributedBmsHost::HandleGetRemoteAbilityInfosPartial(Parcel &data, Parcel &reply)
+{
+    APP_LOGI("DistributedBmsHost handle get remote ability infos partial");
+    std::vector<ElementName> elementNames;
+    if (!GetParcelableInfos<ElementName>(data, elementNames)) {
+        APP_LOGE("GetRemoteAbilityInfosPartial get parcelable infos failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::string localeInfo = data.ReadString();
+    RemoteAbilityInfoOptions options;
+    if (!ReadRemoteAbilityInfoOptions(data, options)) {
+        APP_LOGE("GetRemoteAbilityInfosPartial read options failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::vector<RemoteAbilityInfoResult> remoteAbilityInfos;
+    DistributedBmsDeadline deadline(DistributedBmsDeadline::ReadFromParcel(data));
+    int ret = GetRemoteAbilityInfosPartial(elementNames, localeInfo, options, remoteAbilityInfos);
+    if (ret != NO_ERROR) {
+        APP_LOGE("GetRemoteAbilityInfosPartial result:%{public}d", ret);
+        return ret;
+    }
+    if (!reply.WriteBool(true)) {
+        APP_LOGE("GetRemoteAbilityInfosPartial write failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!WriteParcelableVector<RemoteAbilityInfoResult>(remoteAbilityInfos, reply)) {
+        APP_LOGE("GetRemoteAbilityInfosPartial write failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return NO_ERROR;
+}
+
+int DistributedBmsHost::HandleGetAbilityInfosPartial(Parcel &data, Parcel &reply)
+{
+    APP_LOGI("DistributedBmsHost handle get ability infos partial");
+    std::vector<ElementName> elementNames;
+    if (!GetParcelableInfos<ElementName>(data, elementNames)) {
+        APP_LOGE("GetAbilityInfosPartial get parcelable infos failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::string localeInfo = data.ReadString();
+    bool hasInfo = data.ReadBool();
+    std::unique_ptr<DistributedBmsAclInfo> info;
+    if (hasInfo) {
+        info.reset(data.ReadParcelable<DistributedBmsAclInfo>());
+        if (info == nullptr) {
+            APP_LOGE("HandleGetAbilityInfosPartial get parcelable info failed");
+            return ERR_APPEXECFWK_PARCEL_ERROR;
+        }
+    }
+    RemoteAbilityInfoOptions options;
+    if (!ReadRemoteAbilityInfoOptions(data, options)) {
+        APP_LOGE("GetAbilityInfosPartial read options failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::vector<RemoteAbilityInfoResult> remoteAbilityInfos;
+    DistributedBmsDeadline deadline(DistributedBmsDeadline::ReadFromParcel(data));
+    int ret = GetAbilityInfosPartial(elementNames, localeInfo, options, remoteAbilityInfos, info.get());
+    if (ret != NO_ERROR) {
+        APP_LOGE("GetAbilityInfosPartial result:%{public}d", ret);
+        return ret;
+    }
+    if (!reply.WriteBool(true)) {
+        APP_LOGE("GetAbilityInfosPartial write failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!WriteParcelableVector<RemoteAbilityInfoResult>(remoteAbilityInfos, reply)) {
+        APP_LOGE("GetAbilityInfosPartial write failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return NO_ERROR;
+}
+
+int DistributedBmsHost::HandleGetRemoteAbilityInfosChunked(Parcel &data, Parcel &reply)
+{
+    APP_LOGI("DistributedBmsHost handle get remote ability infos chunked");
+    std::vector<ElementName> elementNames;
+    if (!GetParcelableInfos<ElementName>(data, elementNames, GET_REMOTE_ABILITY_INFOS_CHUNKED_MAX_SIZE)) {
+        APP_LOGE("GetRemoteAbilityInfosChunked get parcelable infos failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::string localeInfo = data.ReadString();
+    uint64_t continuationToken = data.ReadUint64();
+    RemoteAbilityInfoOptions options;
+    if (!ReadRemoteAbilityInfoOptions(data, options)) {
+        APP_LOGE("GetRemoteAbilityInfosChunked read options failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::vector<RemoteAbilityInfoResult> remoteAbilityInfos;
+    DistributedBmsDeadline deadline(DistributedBmsDeadline::ReadFromParcel(data));
+    int ret = GetRemoteAbilityInfosChunked(elementNames, localeInfo, options, continuationToken,
+        remoteAbilityInfos);
+    if (ret != NO_ERROR) {
+        APP_LOGE("GetRemoteAbilityInfosChunked result:%{public}d", ret);
+        return ret;
+    }
+    if (!reply.WriteBool(true) || !reply.WriteUint64(continuationToken)) {
+        APP_LOGE("GetRemoteAbilityInfosChunked write failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    if (!WriteParcelableVector<RemoteAbilityInfoResult>(remoteAbilityInfos, reply)) {
+        APP_LOGE("GetRemoteAbilityInfosChunked write failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    return NO_ERROR;
+}
+
+int DistributedBmsHost::HandleGetRemoteAbilityInfosAsync(MessageParcel &data, MessageParcel &reply)
+{
+    APP_LOGI("DistributedBmsHost handle get remote ability infos async");
+    sptr<IRemoteObject> callback = data.ReadRemoteObject();
+    if (callback == nullptr) {
+        APP_LOGE("GetRemoteAbilityInfosAsync read callback failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::vector<ElementName> elementNames;
+    if (!GetParcelableInfos<ElementName>(data, elementNames)) {
+        APP_LOGE("GetRemoteAbilityInfosAsync get parcelable infos failed");
+        // the caller does not wait for a reply, the failure is only seen through the callback
+        sptr<IDistributedBmsCallback> resultCallback = iface_cast<IDistributedBmsCallback>(callback);
+        if (resultCallback != nullptr) {
+            resultCallback->OnRemoteAbilityInfosResult(ERR_APPEXECFWK_PARCEL_ERROR, {});
+        }
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::string localeInfo = data.ReadString();
+    int ret = GetRemoteAbilityInfosAsync(elementNames, localeInfo, callback);
+    if (ret != NO_ERROR) {
+        APP_LOGE("GetRemoteAbilityInfosAsync result:%{public}d", ret);
+    }
+    return ret;
+}
+
+int DistributedBmsHost::HandleGetRemoteBundleVersionCodeAsync(MessageParcel &data, MessageParcel &reply)
+{
+    APP_LOGI("DistributedBmsHost handle get remote bundle version code async");
+    std::string deviceId = data.ReadString();
+    std::string bundleName = data.ReadString();
+    sptr<IRemoteObject> callback = data.ReadRemoteObject();
+    if (callback == nullptr) {
+        APP_LOGE("GetRemoteBundleVersionCodeAsync read callback failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    int ret = GetRemoteBundleVersionCodeAsync(deviceId, bundleName, callback);
+    if (ret != NO_ERROR) {
+        APP_LOGE("GetRemoteBundleVersionCodeAsync result:%{public}d", ret);
+    }
+    return ret;
+}
+
+int DistributedBmsHost::HandleGetDistributedBundleInfoAsync(MessageParcel &data, MessageParcel &reply)
+{
+    APP_LOGI("DistributedBmsHost handle get distributedBundleInfo async");
+    std::string networkId = data.ReadString();
+    std::string bundleName = data.ReadString();
+    sptr<IRemoteObject> callback = data.ReadRemoteObject();
+    if (callback == nullptr) {
+        APP_LOGE("GetDistributedBundleInfoAsync read callback failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    int ret = GetDistributedBundleInfoAsync(networkId, bundleName, callback);
+    if (ret != NO_ERROR) {
+        APP_LOGE("GetDistributedBundleInfoAsync result:%{public}d", ret);
+    }
+    return ret;
+}
+
+bool DistributedBmsHost::WriteBinaryInfos(const std::vector<RemoteAbilityBinaryInfo> &infos, MessageParcel &reply)
+{
+    // the reply to a remote device goes over dbinder, which carries no ashmem
+    if (!RemoteAbilityBinaryInfo::MarshallingInfos(infos, reply, IPCSkeleton::IsLocalCalling())) {
+        APP_LOGE("write binary infos failed");
+        return false;
+    }
+    return true;
+}
+
+bool DistributedBmsHost::ReadRemoteAbilityInfoOptions(Parcel &data, RemoteAbilityInfoOptions &options)
+{
+    // a requester without field selection sends no options and gets every field
+    if (data.GetReadableBytes() == 0) {
+        return true;
+    }
+    std::unique_ptr<RemoteAbilityInfoOptions> info(data.ReadParcelable<RemoteAbilityInfoOptions>());
+    if (info == nullptr) {
+        return false;
+    }
+    options = *info;
+    return true;
+}
+
 template<typename T>
 bool DistributedBmsHost::WriteParcelableVector(std::vector<T> &parcelableVector, Parcel &reply)
 {
@@ -309,9 +658,15 @@ bool DistributedBmsHost::WriteParcelableVector(std::vector<T> &parcelableVector,
 
 template<typename T>
 bool DistributedBmsHost::GetParcelableInfos(Parcel &data, std::vector<T> &parcelableInfos)
+{
+    return GetParcelableInfos<T>(data, parcelableInfos, GET_REMOTE_ABILITY_INFO_MAX_SIZE);
+}
+
+template<typename T>
+bool DistributedBmsHost::GetParcelableInfos(Parcel &data, std::vector<T> &parcelableInfos, int32_t maxSize)
 {
     int32_t infoSize = data.ReadInt32();
-    if (infoSize > GET_REMOTE_ABILITY_INFO_MAX_SIZE || infoSize < MIN_SIZE) {
+    if (infoSize > maxSize || infoSize < MIN_SIZE) {
         APP_LOGE("GetParcelableInfos elements num exceeds the limit %{public}d", infoSize);
         return false;
     }
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed_bundle_info_codec.h"
+
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#include "app_log_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+    constexpr uint8_t VARINT_PAYLOAD_MASK = 0x7F;
+    constexpr uint8_t VARINT_CONTINUATION = 0x80;
+    constexpr uint32_t VARINT_PAYLOAD_BITS = 7;
+    constexpr uint32_t VARINT_MAX_SHIFT = 63;
+
+    class RecordWriter {
+    public:
+        void WriteByte(uint8_t value)
+        {
+            buffer_.push_back(value);
+        }
+
+        void WriteVarint(uint64_t value)
+        {
+            while (value >= VARINT_CONTINUATION) {
+                buffer_.push_back(static_cast<uint8_t>((value & VARINT_PAYLOAD_MASK) | VARINT_CONTINUATION));
+                value >>= VARINT_PAYLOAD_BITS;
+            }
+            buffer_.push_back(static_cast<uint8_t>(value));
+        }
+
+        // signed values are zigzag encoded so that small negative numbers stay short
+        template<typename T>
+        void WriteInteger(T value)
+        {
+            if constexpr (std::is_signed_v<T>) {
+                int64_t signedValue = static_cast<int64_t>(value);
+                WriteVarint((static_cast<uint64_t>(signedValue) << 1) ^ static_cast<uint64_t>(signedValue >> 63));
+            } else {
+                WriteVarint(static_cast<uint64_t>(value));
+            }
+        }
+
+        void WriteString(const std::string &value)
+        {
+            auto item = stringIndexes_.find(value);
+            WriteVarint(item == stringIndexes_.end() ? 0 : item->second);
+        }
+
+        // the string table is written before the fields, so every string is added first
+        void AddString(const std::string &value)
+        {
+            if (stringIndexes_.emplace(value, strings_.size()).second) {
+                strings_.emplace_back(&value);
+            }
+        }
+
+        std::vector<uint8_t> Finish(uint8_t version)
+        {
+            std::vector<uint8_t> fields;
+            fields.swap(buffer_);
+            buffer_.push_back(version);
+            WriteVarint(strings_.size());
+            for (const std::string *value : strings_) {
+                WriteVarint(value->size());
+                buffer_.insert(buffer_.end(), value->begin(), value->end());
+            }
+            buffer_.insert(buffer_.end(), fields.begin(), fields.end());
+            return std::move(buffer_);
+        }
+
+    private:
+        std::vector<uint8_t> buffer_;
+        std::vector<const std::string *> strings_;
+        std::unordered_map<std::string, uint64_t> stringIndexes_;
+    };
+
+    class RecordReader {
+    public:
+        explicit RecordReader(const std::vector<uint8_t> &buffer) : buffer_(buffer) {}
+
+        bool ReadByte(uint8_t &value)
+        {
+            if (offset_ >= buffer_.size()) {
+                return false;
+            }
+            value = buffer_[offset_++];
+            return true;
+        }
+
+        bool ReadVarint(uint64_t &value)
+        {
+            value = 0;
+            for (uint32_t shift = 0; shift <= VARINT_MAX_SHIFT; shift += VARINT_PAYLOAD_BITS) {
+                uint8_t byte = 0;
+                if (!ReadByte(byte)) {
+                    return false;
+                }
+                value |= static_cast<uint64_t>(byte & VARINT_PAYLOAD_MASK) << shift;
+                if ((byte & VARINT_CONTINUATION) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template<typename T>
+        bool ReadInteger(T &value)
+        {
+            uint64_t rawValue = 0;
+            if (!ReadVarint(rawValue)) {
+                return false;
+            }
+            if constexpr (std::is_signed_v<T>) {
+                value = static_cast<T>(static_cast<int64_t>((rawValue >> 1) ^ (~(rawValue & 1) + 1)));
+            } else {
+                value = static_cast<T>(rawValue);
+            }
+            return true;
+        }
+
+        bool ReadStringTable()
+        {
+            uint64_t count = 0;
+            // every string takes at least its length byte, which bounds a corrupted count
+            if (!ReadVarint(count) || count > buffer_.size() - offset_) {
+                return false;
+            }
+            strings_.reserve(count);
+            for (uint64_t i = 0; i < count; ++i) {
+                uint64_t size = 0;
+                if (!ReadVarint(size) || size > buffer_.size() - offset_) {
+                    return false;
+                }
+                strings_.emplace_back(buffer_.begin() + offset_, buffer_.begin() + offset_ + size);
+                offset_ += size;
+            }
+            return true;
+        }
+
+        bool ReadString(std::string &value)
+        {
+            uint64_t index = 0;
+            if (!ReadVarint(index) || index >= strings_.size()) {
+                return false;
+            }
+            value = strings_[index];
+            return true;
+        }
+
+        // a count of items that take at least one byte each
+        bool ReadCount(uint64_t &count)
+        {
+            return ReadVarint(count) && count <= buffer_.size() - offset_;
+        }
+
+    private:
+        const std::vector<uint8_t> &buffer_;
+        size_t offset_ = 0;
+        std::vector<std::string> strings_;
+    };
+
+    bool DecodeRecord(RecordReader &reader, DistributedBundleInfo &info)
+    {
+        uint8_t enabled = 0;
+        uint64_t moduleCount = 0;
+        if (!reader.ReadStringTable() || !reader.ReadInteger(info.version) || !reader.ReadInteger(info.versionCode) ||
+            !reader.ReadInteger(info.compatibleVersionCode) || !reader.ReadInteger(info.minCompatibleVersion) ||
+            !reader.ReadInteger(info.targetVersionCode) || !reader.ReadString(info.bundleName) ||
+            !reader.ReadString(info.versionName) || !reader.ReadString(info.appId) || !reader.ReadByte(enabled) ||
+            !reader.ReadInteger(info.accessTokenId) || !reader.ReadInteger(info.updateTime) ||
+            !reader.ReadCount(moduleCount)) {
+            return false;
+        }
+        info.enabled = enabled != 0;
+        info.moduleInfos.resize(moduleCount);
+        for (auto &moduleInfo : info.moduleInfos) {
+            uint64_t abilityCount = 0;
+            if (!reader.ReadString(moduleInfo.moduleName) || !reader.ReadCount(abilityCount)) {
+                return false;
+            }
+            moduleInfo.abilities.resize(abilityCount);
+            for (auto &abilityInfo : moduleInfo.abilities) {
+                int32_t type = 0;
+                uint64_t permissionCount = 0;
+                if (!reader.ReadString(abilityInfo.abilityName) || !reader.ReadInteger(type) ||
+                    !reader.ReadByte(enabled) || !reader.ReadCount(permissionCount)) {
+                    return false;
+                }
+                abilityInfo.type = static_cast<AbilityType>(type);
+                abilityInfo.enabled = enabled != 0;
+                abilityInfo.permissions.resize(permissionCount);
+                for (auto &permission : abilityInfo.permissions) {
+                    if (!reader.ReadString(permission)) {
+                        return false;
+                    }
+                }
+            }
+        }
+        // fields appended to this schema version by newer devices are left unread
+        return true;
+    }
+}
+
+std::vector<uint8_t> DistributedBundleInfoCodec::Encode(const DistributedBundleInfo &info)
+{
+    RecordWriter writer;
+    writer.AddString(info.bundleName);
+    writer.AddString(info.versionName);
+    writer.AddString(info.appId);
+    for (const auto &moduleInfo : info.moduleInfos) {
+        writer.AddString(moduleInfo.moduleName);
+        for (const auto &abilityInfo : moduleInfo.abilities) {
+            writer.AddString(abilityInfo.abilityName);
+            for (const auto &permission : abilityInfo.permissions) {
+                writer.AddString(permission);
+            }
+        }
+    }
+    writer.WriteInteger(info.version);
+    writer.WriteInteger(info.versionCode);
+    writer.WriteInteger(info.compatibleVersionCode);
+    writer.WriteInteger(info.minCompatibleVersion);
+    writer.WriteInteger(info.targetVersionCode);
+    writer.WriteString(info.bundleName);
+    writer.WriteString(info.versionName);
+    writer.WriteString(info.appId);
+    writer.WriteByte(info.enabled ? 1 : 0);
+    writer.WriteInteger(info.accessTokenId);
+    writer.WriteInteger(info.updateTime);
+    writer.WriteVarint(info.moduleInfos.size());
+    for (const auto &moduleInfo : info.moduleInfos) {
+        writer.WriteString(moduleInfo.moduleName);
+        writer.WriteVarint(moduleInfo.abilities.size());
+        for (const auto &abilityInfo : moduleInfo.abilities) {
+            writer.WriteString(abilityInfo.abilityName);
+            writer.WriteInteger(static_cast<int32_t>(abilityInfo.type));
+            writer.WriteByte(abilityInfo.enabled ? 1 : 0);
+            writer.WriteVarint(abilityInfo.permissions.size());
+            for (const auto &permission : abilityInfo.permissions) {
+                writer.WriteString(permission);
+            }
+        }
+    }
+    return writer.Finish(SCHEMA_VERSION);
+}
+
+bool DistributedBundleInfoCodec::Decode(const std::vector<uint8_t> &value, DistributedBundleInfo &info)
+{
+    if (value.empty()) {
+        return false;
+    }
+    // json starts with a brace or white space, never with a schema version
+    if (value[0] != SCHEMA_VERSION) {
+        return info.FromJsonString(std::string(value.begin(), value.end()));
+    }
+    RecordReader reader(value);
+    uint8_t version = 0;
+    DistributedBundleInfo decodedInfo;
+    if (!reader.ReadByte(version) || !DecodeRecord(reader, decodedInfo)) {
+        APP_LOGE("bundle info record is corrupted");
+        return false;
+    }
+    info = std::move(decodedInfo);
+    return true;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -15,12 +15,15 @@
 
 #include "distributed_data_storage.h"
 
+#include <cstring>
 #include <set>
 #include <unistd.h>
 
 #include "account_manager_helper.h"
 #include "app_log_wrapper.h"
+#include "dbms_bundle_name_index.h"
 #include "distributed_bms.h"
+#include "distributed_bundle_info_codec.h"
 #include "parameter.h"
 
 using namespace OHOS::DistributedKv;
@@ -41,6 +44,23 @@ const int32_t FLAGS = static_cast<int32_t>(GetBundleInfoFlag::GET_BUNDLE_INFO_WI
     static_cast<int32_t>(GetBundleInfoFlag::GET_BUNDLE_INFO_WITH_DISABLE);
 const uint32_t DEVICE_UDID_LENGTH = 65;
 const std::string EMPTY_DEVICE_ID = "";
+const std::string KEY_SEPARATOR = Constants::FILE_UNDERLINE;
+// set by a product once every device of its network reads the compact record
+const char* COMPACT_RECORD_PARAMETER = "const.dbms.compact_bundle_info.enable";
+const char* PARAMETER_TRUE = "true";
+const uint32_t PARAMETER_VALUE_LENGTH = 8;
+
+// a key is udid + "_" + bundleName, and an udid has no underline
+bool SplitKey(const std::string &key, std::string &udid, std::string &bundleName)
+{
+    size_t pos = key.find(KEY_SEPARATOR);
+    if (pos == std::string::npos || pos == 0) {
+        return false;
+    }
+    udid = key.substr(0, pos);
+    bundleName = key.substr(pos + KEY_SEPARATOR.size());
+    return true;
+}
 }  // namespace
 
 std::shared_ptr<DistributedDataStorage> DistributedDataStorage::instance_ = nullptr;
@@ -67,6 +87,12 @@ DistributedDataStorage::DistributedDataStorage()
 DistributedDataStorage::~DistributedDataStorage()
 {
     APP_LOGI("instance is destroyed");
+    {
+        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+        if (kvStorePtr_ != nullptr && isObserverSubscribed_) {
+            kvStorePtr_->UnSubscribeKvStore(SubscribeType::SUBSCRIBE_TYPE_REMOTE, observer_);
+        }
+    }
     dataManager_.CloseKvStore(appId_, storeId_);
 }
 
@@ -113,8 +139,10 @@ bool DistributedDataStorage::InnerSaveStorageDistributeInfo(const DistributedBun
     }
     std::string keyOfData = DeviceAndNameToKey(udid, distributedBundleInfo.bundleName);
     Key key(keyOfData);
-    Value value(distributedBundleInfo.ToString());
-    std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+    // a device without the codec reads the json only
+    Value value = IsCompactRecordEnabled() ? Value(DistributedBundleInfoCodec::Encode(distributedBundleInfo)) :
+        Value(distributedBundleInfo.ToString());
+    std::unique_lock<std::mutex> lock(kvStorePtrMutex_);
     if (kvStorePtr_ == nullptr) {
         APP_LOGE("kvStorePtr_ is null");
         return false;
@@ -128,10 +156,24 @@ bool DistributedDataStorage::InnerSaveStorageDistributeInfo(const DistributedBun
         APP_LOGE("put to kvStore error: %{public}d", status);
         return false;
     }
+    lock.unlock();
+    // the store notifies the changes of remote devices only, and Load takes the index lock before the store lock
+    DbmsBundleNameIndex::GetInstance()->Put(udid, distributedBundleInfo.bundleName,
+        distributedBundleInfo.accessTokenId);
     APP_LOGI("put value to kvStore success");
     return true;
 }
 
+bool DistributedDataStorage::IsCompactRecordEnabled()
+{
+    static const bool isEnabled = [] {
+        char value[PARAMETER_VALUE_LENGTH] = {0};
+        return GetParameter(COMPACT_RECORD_PARAMETER, "", value, PARAMETER_VALUE_LENGTH) > 0 &&
+            strcmp(value, PARAMETER_TRUE) == 0;
+    }();
+    return isEnabled;
+}
+
 void DistributedDataStorage::DeleteStorageDistributeInfo(const std::string &bundleName, int32_t userId)
 {
     APP_LOGI("delete DistributedBundleInfo");
@@ -152,7 +194,7 @@ void DistributedDataStorage::DeleteStorageDistributeInfo(const std::string &bund
     }
     std::string keyOfData = DeviceAndNameToKey(udid, bundleName);
     Key key(keyOfData);
-    std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+    std::unique_lock<std::mutex> lock(kvStorePtrMutex_);
     if (kvStorePtr_ == nullptr) {
         APP_LOGE("kvStorePtr_ is null");
         return;
@@ -166,6 +208,8 @@ void DistributedDataStorage::DeleteStorageDistributeInfo(const std::string &bund
         APP_LOGE("delete key error: %{public}d", status);
         return;
     }
+    lock.unlock();
+    DbmsBundleNameIndex::GetInstance()->Remove(udid, bundleName);
     APP_LOGI("delete value to kvStore success");
 }
 
@@ -203,7 +247,7 @@ bool DistributedDataStorage::GetStorageDistributeInfo(const std::string &network
         APP_LOGW("distribute database ipc error and try to call again, result = %{public}d", status);
     }
     if (status == Status::SUCCESS) {
-        if (!info.FromJsonString(value.ToString())) {
+        if (!DistributedBundleInfoCodec::Decode(value.Data(), info)) {
             APP_LOGE("it's an error value");
             kvStorePtr_->Delete(key);
             return false;
@@ -236,37 +280,62 @@ int32_t DistributedDataStorage::GetDistributedBundleName(const std::string &netw
         APP_LOGE("SyncAndCompleted failed");
         return ERR_BUNDLE_MANAGER_INTERNAL_ERROR;
     }
-    Key allEntryKeyPrefix("");
-    std::vector<Entry> allEntries;
+    auto bundleNameIndex = DbmsBundleNameIndex::GetInstance();
+    bundleNameIndex->BindNetworkId(networkId, udid);
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        if (kvStorePtr_ == nullptr) {
-            APP_LOGE("kvStorePtr_ is null");
-            return ERR_APPEXECFWK_NULL_PTR;
-        }
-        Status status = kvStorePtr_->GetEntries(allEntryKeyPrefix, allEntries);
-        if (status != Status::SUCCESS) {
-            APP_LOGE("dataManager_ GetEntries error: %{public}d", status);
-            return ERR_BUNDLE_MANAGER_INTERNAL_ERROR;
+        if (!isObserverSubscribed_) {
+            bundleNameIndex->Invalidate(udid);
         }
     }
-    for (auto entry : allEntries) {
-        std::string key = entry.key.ToString();
-        std::string value =  entry.value.ToString();
-        if (key.find(udid) == std::string::npos) {
-            continue;
-        }
-        DistributedBundleInfo distributedBundleInfo;
-        if (distributedBundleInfo.FromJsonString(value) && distributedBundleInfo.accessTokenId == accessTokenId) {
-            bundleName = distributedBundleInfo.bundleName;
-            return OHOS::NO_ERROR;
-        }
+    // the index is loaded once after the first sync, the change notifications keep it up to date from then on
+    if (!bundleNameIndex->IsLoaded(udid) && !LoadBundleNameIndex(udid)) {
+        APP_LOGE("load bundle names of %{public}s failed", AnonymizeUdid(udid).c_str());
+        return ERR_BUNDLE_MANAGER_INTERNAL_ERROR;
+    }
+    if (bundleNameIndex->Get(udid, accessTokenId, bundleName)) {
+        return OHOS::NO_ERROR;
     }
     APP_LOGE("get distributed bundleName no matching data: %{public}s %{public}s %{public}d",
         AnonymizeUdid(networkId).c_str(), AnonymizeUdid(udid).c_str(), accessTokenId);
     return ERR_BUNDLE_MANAGER_BUNDLE_NOT_EXIST;
 }
 
+bool DistributedDataStorage::LoadBundleNameIndex(const std::string &udid)
+{
+    return DbmsBundleNameIndex::GetInstance()->Load(udid, [this, &udid](DbmsBundleNameIndex::Rows &rows) {
+        Key deviceKeyPrefix(udid + KEY_SEPARATOR);
+        std::vector<Entry> deviceEntries;
+        {
+            std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+            if (kvStorePtr_ == nullptr) {
+                APP_LOGE("kvStorePtr_ is null");
+                return false;
+            }
+            Status status = kvStorePtr_->GetEntries(deviceKeyPrefix, deviceEntries);
+            if (status != Status::SUCCESS) {
+                APP_LOGE("dataManager_ GetEntries error: %{public}d", status);
+                return false;
+            }
+        }
+        for (const auto &entry : deviceEntries) {
+            std::string keyUdid;
+            std::string bundleName;
+            if (!SplitKey(entry.key.ToString(), keyUdid, bundleName) || keyUdid != udid) {
+                continue;
+            }
+            DistributedBundleInfo distributedBundleInfo;
+            if (!DistributedBundleInfoCodec::Decode(entry.value.Data(), distributedBundleInfo)) {
+                APP_LOGW("decode DistributedBundleInfo key:%{public}s failed",
+                    AnonymizeUdid(entry.key.ToString()).c_str());
+                continue;
+            }
+            rows.emplace_back(bundleName, distributedBundleInfo.accessTokenId);
+        }
+        return true;
+    });
+}
+
 std::string DistributedDataStorage::AnonymizeUdid(const std::string& udid)
 {
     if (udid.length() < PRINTF_LENGTH) {
@@ -373,8 +442,15 @@ Status DistributedDataStorage::GetKvStore()
     Status status = dataManager_.GetSingleKvStore(options, appId_, storeId_, kvStorePtr_);
     if (status != Status::SUCCESS) {
         APP_LOGE("return error: %{public}d", status);
-    } else {
-        APP_LOGI("get kvStore success");
+        return status;
+    }
+    APP_LOGI("get kvStore success");
+    if (kvStorePtr_ != nullptr) {
+        Status subscribeStatus = kvStorePtr_->SubscribeKvStore(SubscribeType::SUBSCRIBE_TYPE_REMOTE, observer_);
+        isObserverSubscribed_ = subscribeStatus == Status::SUCCESS;
+        if (!isObserverSubscribed_) {
+            APP_LOGW("subscribe kvStore error: %{public}d", subscribeStatus);
+        }
     }
     return status;
 }
@@ -499,7 +575,8 @@ std::map<std::string, DistributedBundleInfo> DistributedDataStorage::GetAllOldDi
 {
     APP_LOGD("start");
     std::map<std::string, DistributedBundleInfo> oldDistributedBundleInfos;
-    std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+    std::vector<std::string> deletedBundleNames;
+    std::unique_lock<std::mutex> lock(kvStorePtrMutex_);
     if (kvStorePtr_ == nullptr) {
         APP_LOGE("kvStorePtr_ is null");
         return oldDistributedBundleInfos;
@@ -509,37 +586,76 @@ std::map<std::string, DistributedBundleInfo> DistributedDataStorage::GetAllOldDi
         APP_LOGE("GetLocalUdid failed");
         return oldDistributedBundleInfos;
     }
-    Key allEntryKeyPrefix("");
-    std::vector<Entry> allEntries;
-    Status status = kvStorePtr_->GetEntries(allEntryKeyPrefix, allEntries);
+    // only the rows of the local device, a substring match of the udid would also hit other keys
+    Key deviceKeyPrefix(udid + KEY_SEPARATOR);
+    std::vector<Entry> deviceEntries;
+    Status status = kvStorePtr_->GetEntries(deviceKeyPrefix, deviceEntries);
     if (status != Status::SUCCESS) {
         APP_LOGE("dataManager_ GetEntries error: %{public}d", status);
         return oldDistributedBundleInfos;
     }
-    for (const auto &entry : allEntries) {
+    for (const auto &entry : deviceEntries) {
         std::string key = entry.key.ToString();
-        if (key.find(udid) == std::string::npos) {
-            continue;
-        }
-        std::string value = entry.value.ToString();
         DistributedBundleInfo distributedBundleInfo;
-        if (distributedBundleInfo.FromJsonString(value)) {
+        if (DistributedBundleInfoCodec::Decode(entry.value.Data(), distributedBundleInfo)) {
             if (std::find(bundleNames.begin(), bundleNames.end(), distributedBundleInfo.bundleName) ==
                 bundleNames.end()) {
                 APP_LOGW("bundleName:%{public}s need delete", distributedBundleInfo.bundleName.c_str());
                 if (kvStorePtr_->Delete(entry.key) != Status::SUCCESS) {
                     APP_LOGE("Delete key:%{public}s failed", AnonymizeUdid(key).c_str());
+                    continue;
                 }
+                deletedBundleNames.emplace_back(distributedBundleInfo.bundleName);
                 continue;
             }
             oldDistributedBundleInfos.emplace(distributedBundleInfo.bundleName, distributedBundleInfo);
         } else {
-            APP_LOGE("DistributionInfo FromJsonString key:%{public}s failed", AnonymizeUdid(key).c_str());
+            APP_LOGE("decode DistributedBundleInfo key:%{public}s failed", AnonymizeUdid(key).c_str());
         }
     }
+    lock.unlock();
+    for (const auto &bundleName : deletedBundleNames) {
+        DbmsBundleNameIndex::GetInstance()->Remove(udid, bundleName);
+    }
     return oldDistributedBundleInfos;
 }
 
+void DistributedDataStorageObserver::OnChange(const DistributedKv::ChangeNotification &changeNotification)
+{
+    auto bundleNameIndex = DbmsBundleNameIndex::GetInstance();
+    if (changeNotification.IsClear()) {
+        bundleNameIndex->Clear();
+        return;
+    }
+    auto putEntries = [&bundleNameIndex](const std::vector<Entry> &entries) {
+        for (const auto &entry : entries) {
+            std::string key = entry.key.ToString();
+            std::string udid;
+            std::string bundleName;
+            if (!SplitKey(key, udid, bundleName)) {
+                continue;
+            }
+            DistributedBundleInfo distributedBundleInfo;
+            if (!DistributedBundleInfoCodec::Decode(entry.value.Data(), distributedBundleInfo)) {
+                APP_LOGW("decode DistributedBundleInfo key:%{public}s failed",
+                    DistributedDataStorage::AnonymizeUdid(key).c_str());
+                bundleNameIndex->Remove(udid, bundleName);
+                continue;
+            }
+            bundleNameIndex->Put(udid, bundleName, distributedBundleInfo.accessTokenId);
+        }
+    };
+    putEntries(changeNotification.GetInsertEntries());
+    putEntries(changeNotification.GetUpdateEntries());
+    for (const auto &entry : changeNotification.GetDeleteEntries()) {
+        std::string udid;
+        std::string bundleName;
+        if (SplitKey(entry.key.ToString(), udid, bundleName)) {
+            bundleNameIndex->Remove(udid, bundleName);
+        }
+    }
+}
+
 DistributedDataStorageCallback::DistributedDataStorageCallback()
 {
     APP_LOGD("create dbms callback instance");
@@ -12,6 +12,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <cstdio>
 #include <cmath>
 #include <unistd.h>
@@ -24,6 +25,7 @@
 #include "image_source.h"
 #include "image_packer.h"
 #include "media_errors.h"
+#include "packing_buffer_pool.h"
 
 namespace OHOS {
 namespace AppExecFwk {
@@ -35,7 +37,6 @@ namespace {
     const std::string BUNDLE_PATH = "/data/app/el1/bundle";
     constexpr int32_t QUALITY = 20;
     constexpr int32_t MUNBER_ONE = 1;
-    constexpr int64_t BUFFER_SIZE = 2 * 1024 * 1024;
     constexpr int32_t FILE_MAX_SIZE = 10240;
     constexpr int32_t FILE_COMPRESS_SIZE = 4096;
     constexpr int32_t WEBP_COMPRESS_SIZE = 128;
@@ -52,6 +53,18 @@ namespace {
     constexpr int32_t INDEX_THREE = 3;
     constexpr int32_t EMPTY_FILE_SIZE = 0;
     constexpr double FILE_SIZE_ERR = -1.0;
+
+    bool PackImage(Media::PixelMap &pixMap, const Media::PackOption &packOption, uint8_t *buffer,
+        size_t capacity, int64_t &packedSize)
+    {
+        Media::ImagePacker imagePacker;
+        if (imagePacker.StartPacking(buffer, static_cast<uint32_t>(capacity), packOption) != Media::SUCCESS ||
+            imagePacker.AddImage(pixMap) != Media::SUCCESS ||
+            imagePacker.FinalizePacking(packedSize) != Media::SUCCESS) {
+            return false;
+        }
+        return packedSize > 0 && static_cast<size_t>(packedSize) <= capacity;
+    }
 }
 bool ImageCompress::IsPathValid(const std::string &srcPath)
 {
@@ -107,6 +120,70 @@ bool ImageCompress::GetImageTypeString(const std::unique_ptr<uint8_t[]> &fileDat
     return true;
 }
 
+void ImageCompress::SetDecodeScaleEnabled(bool enabled)
+{
+    decodeScaleEnabled_ = enabled;
+}
+
+void ImageCompress::SetMaxEdge(int32_t maxEdge)
+{
+    maxEdge_ = maxEdge;
+}
+
+bool ImageCompress::IsImageNeedCompressByEdge(const std::unique_ptr<uint8_t[]> &fileData, size_t fileSize)
+{
+    if (maxEdge_ <= 0) {
+        return false;
+    }
+    uint32_t errorCode = 0;
+    Media::SourceOptions options;
+    std::unique_ptr<Media::ImageSource> imageSourcePtr =
+        Media::ImageSource::CreateImageSource(fileData.get(), fileSize, options, errorCode);
+    if (imageSourcePtr == nullptr) {
+        APP_LOGE("imageSourcePtr nullptr");
+        return false;
+    }
+    // only the header is parsed, the image is not decoded
+    Media::ImageInfo imageInfo;
+    if (imageSourcePtr->GetImageInfo(imageInfo) != Media::SUCCESS) {
+        APP_LOGW("GetImageInfo failed");
+        return false;
+    }
+    return std::max(imageInfo.size.width, imageInfo.size.height) > maxEdge_;
+}
+
+double ImageCompress::LimitRatioByEdge(Media::ImageSource &imageSource, size_t fileSize, double ratio)
+{
+    Media::ImageInfo imageInfo;
+    if (imageSource.GetImageInfo(imageInfo) != Media::SUCCESS ||
+        imageInfo.size.width <= 0 || imageInfo.size.height <= 0) {
+        APP_LOGW("GetImageInfo failed, edge not limited");
+        return ratio;
+    }
+    // an image small in bytes is only scaled for the edge, never enlarged
+    double sizeRatio = IsImageNeedCompressBySize(fileSize) ? ratio : MUNBER_ONE;
+    double edgeRatio = static_cast<double>(maxEdge_) / std::max(imageInfo.size.width, imageInfo.size.height);
+    return std::min(sizeRatio, edgeRatio);
+}
+
+bool ImageCompress::GetTargetSize(Media::ImageSource &imageSource, double ratio, Media::Size &targetSize)
+{
+    if (ratio <= 0 || ratio >= MUNBER_ONE) {
+        return false;
+    }
+    Media::ImageInfo imageInfo;
+    if (imageSource.GetImageInfo(imageInfo) != Media::SUCCESS ||
+        imageInfo.size.width <= 0 || imageInfo.size.height <= 0) {
+        APP_LOGW("GetImageInfo failed, scale after decode");
+        return false;
+    }
+    targetSize.width = std::max(MUNBER_ONE, static_cast<int32_t>(std::round(imageInfo.size.width * ratio)));
+    targetSize.height = std::max(MUNBER_ONE, static_cast<int32_t>(std::round(imageInfo.size.height * ratio)));
+    APP_LOGD("decode %{public}d*%{public}d to %{public}d*%{public}d", imageInfo.size.width,
+        imageInfo.size.height, targetSize.width, targetSize.height);
+    return true;
+}
+
 bool ImageCompress::CompressImageByContent(const std::unique_ptr<uint8_t[]> &fileData, size_t fileSize,
     std::unique_ptr<uint8_t[]> &compressedData, int64_t &compressedSize, std::string &imageType)
 {
@@ -124,47 +201,76 @@ bool ImageCompress::CompressImageByContent(const std::unique_ptr<uint8_t[]> &fil
         APP_LOGE("imageSourcePtr nullptr");
         return false;
     }
+    double ratio = CalculateRatio(fileSize, imageType);
+    if (ratio == FILE_SIZE_ERR) {
+        APP_LOGE("CalculateRatio failed: ratio is %{public}f", ratio);
+        return false;
+    }
+    if (maxEdge_ > 0) {
+        ratio = LimitRatioByEdge(*imageSourcePtr, fileSize, ratio);
+    }
+    APP_LOGD("ratio is %{public}f", ratio);
     // do compress
     Media::DecodeOptions decodeOptions;
+    Media::Size targetSize;
+    bool scaleOnDecode = decodeScaleEnabled_ && GetTargetSize(*imageSourcePtr, ratio, targetSize);
+    if (scaleOnDecode) {
+        // let the decoder produce the small bitmap instead of decoding the full one and scaling it down
+        decodeOptions.desiredSize = targetSize;
+    }
     uint32_t pixMapError = 0;
     std::unique_ptr<Media::PixelMap> pixMap = imageSourcePtr->CreatePixelMap(decodeOptions, pixMapError);
     if (pixMap == nullptr || pixMapError != Media::SUCCESS) {
         APP_LOGE("CreatePixelMap failed");
         return false;
     }
-    double ratio = CalculateRatio(fileSize, imageType);
-    if (ratio == FILE_SIZE_ERR) {
-        APP_LOGE("CalculateRatio failed: ratio is %{public}f", ratio);
-        return false;
+    if (!scaleOnDecode) {
+        pixMap->scale(ratio, ratio);
+    } else if (pixMap->GetWidth() != targetSize.width || pixMap->GetHeight() != targetSize.height) {
+        APP_LOGD("decoder returned %{public}d*%{public}d", pixMap->GetWidth(), pixMap->GetHeight());
+        pixMap->scale(static_cast<float>(targetSize.width) / pixMap->GetWidth(),
+            static_cast<float>(targetSize.height) / pixMap->GetHeight());
     }
-    APP_LOGD("ratio is %{public}f", ratio);
-    pixMap->scale(ratio, ratio);
-    Media::ImagePacker imagePacker;
     Media::PackOption packOption;
     packOption.format = imageType;
     packOption.quality = QUALITY;
     packOption.numberHint = MUNBER_ONE;
-    uint8_t *resultBuffer = reinterpret_cast<uint8_t *>(malloc(BUFFER_SIZE));
+    auto bufferPool = PackingBufferPool::GetInstance();
+    size_t capacity = 0;
+    std::unique_ptr<uint8_t[]> resultBuffer = bufferPool->Acquire(0, capacity);
     if (resultBuffer == nullptr) {
         APP_LOGE("image packer malloc buffer failed.");
         return false;
     }
-    if (imagePacker.StartPacking(resultBuffer, BUFFER_SIZE, packOption) != Media::SUCCESS ||
-        imagePacker.AddImage(*pixMap) != Media::SUCCESS ||
-        imagePacker.FinalizePacking(compressedSize) != Media::SUCCESS) {
-        APP_LOGE_NOFUNC("StartPacking|AddImage|FinalizePacking failed");
-        return false;
+    if (!PackImage(*pixMap, packOption, resultBuffer.get(), capacity, compressedSize)) {
+        bufferPool->Release(std::move(resultBuffer));
+        if (capacity >= bufferPool->GetMaxBufferSize()) {
+            APP_LOGE_NOFUNC("StartPacking|AddImage|FinalizePacking failed");
+            return false;
+        }
+        // the learnt buffer size is too small for this icon, retry with the largest one
+        APP_LOGD("pack with %{public}d bytes failed, retry", static_cast<int32_t>(capacity));
+        resultBuffer = bufferPool->Acquire(bufferPool->GetMaxBufferSize(), capacity);
+        if (resultBuffer == nullptr) {
+            APP_LOGE("image packer malloc buffer failed.");
+            return false;
+        }
+        if (!PackImage(*pixMap, packOption, resultBuffer.get(), capacity, compressedSize)) {
+            bufferPool->Release(std::move(resultBuffer));
+            APP_LOGE_NOFUNC("StartPacking|AddImage|FinalizePacking failed");
+            return false;
+        }
     }
-    compressedData = std::make_unique<uint8_t[]>(compressedSize);
     APP_LOGD("compressedSize is %{public}d", static_cast<int32_t>(compressedSize));
-    uint8_t *result = compressedData.get();
-    if (memcpy_s(result, compressedSize, resultBuffer, compressedSize) != EOK) {
-        free(resultBuffer);
-        APP_LOGE("memcpy_s to compressedData failed!");
-        return false;
-    }
-    free(resultBuffer);
+    bufferPool->RecordPackedSize(static_cast<size_t>(compressedSize));
+    // hand the packing buffer out as is, ReleaseCompressedData gives it back to the pool
+    compressedData = std::move(resultBuffer);
     return true;
 }
+
+void ImageCompress::ReleaseCompressedData(std::unique_ptr<uint8_t[]> &compressedData)
+{
+    PackingBufferPool::GetInstance()->Release(std::move(compressedData));
+}
+}
 }
-}
\ No newline at end of file
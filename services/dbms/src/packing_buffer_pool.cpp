@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "packing_buffer_pool.h"
+
+#include <algorithm>
+#include <new>
+
+#include "app_log_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+    constexpr size_t MIN_BUFFER_SIZE = 64 * 1024;
+    constexpr size_t MAX_BUFFER_SIZE = 2 * 1024 * 1024;
+    constexpr size_t MAX_POOLED_BUFFERS = 4;
+    constexpr size_t PAGE_SIZE = 4096;
+    constexpr size_t HEADROOM_MULTIPLE = 2;
+}
+
+std::mutex PackingBufferPool::instanceMutex_;
+std::shared_ptr<PackingBufferPool> PackingBufferPool::instance_ = nullptr;
+
+PackingBufferPool::PackingBufferPool(size_t minBufferSize, size_t maxBufferSize, size_t maxPooledBuffers)
+    : minBufferSize_(std::min(minBufferSize, maxBufferSize)), maxBufferSize_(maxBufferSize),
+    maxPooledBuffers_(maxPooledBuffers)
+{
+}
+
+std::shared_ptr<PackingBufferPool> PackingBufferPool::GetInstance()
+{
+    if (instance_ == nullptr) {
+        std::lock_guard<std::mutex> lock(instanceMutex_);
+        if (instance_ == nullptr) {
+            instance_ = std::make_shared<PackingBufferPool>(MIN_BUFFER_SIZE, MAX_BUFFER_SIZE, MAX_POOLED_BUFFERS);
+        }
+    }
+    return instance_;
+}
+
+std::unique_ptr<uint8_t[]> PackingBufferPool::AllocateBuffer(size_t capacity)
+{
+    std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[capacity]);
+    if (buffer == nullptr) {
+        return nullptr;
+    }
+    // touch every page up front so packing does not take the page faults
+    for (size_t offset = 0; offset < capacity; offset += PAGE_SIZE) {
+        buffer[offset] = 0;
+    }
+    return buffer;
+}
+
+size_t PackingBufferPool::GetBufferSizeLocked() const
+{
+    size_t size = minBufferSize_;
+    while (size < maxPackedSize_ * HEADROOM_MULTIPLE && size < maxBufferSize_) {
+        size *= HEADROOM_MULTIPLE;
+    }
+    return std::min(size, maxBufferSize_);
+}
+
+void PackingBufferPool::UpdateHighWaterLocked()
+{
+    stats_.highWaterBytes = std::max(stats_.highWaterBytes, stats_.pooledBytes + stats_.outstandingBytes);
+}
+
+void PackingBufferPool::TrackLocked(const uint8_t *buffer, size_t capacity)
+{
+    // a buffer freed by its holder instead of released leaves a stale entry that may share the address
+    auto item = outstanding_.find(buffer);
+    if (item != outstanding_.end()) {
+        stats_.outstandingBytes -= item->second;
+    }
+    outstanding_[buffer] = capacity;
+    stats_.outstandingBytes += capacity;
+}
+
+std::unique_ptr<uint8_t[]> PackingBufferPool::Acquire(size_t minCapacity, size_t &capacity)
+{
+    std::unique_ptr<uint8_t[]> buffer;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.acquireCount++;
+        capacity = std::min(std::max(GetBufferSizeLocked(), minCapacity), maxBufferSize_);
+        auto item = std::find_if(pooled_.begin(), pooled_.end(),
+            [capacity](const auto &pooled) { return pooled.second >= capacity; });
+        if (item != pooled_.end()) {
+            stats_.hitCount++;
+            capacity = item->second;
+            buffer = std::move(item->first);
+            pooled_.erase(item);
+            stats_.pooledBytes -= capacity;
+            TrackLocked(buffer.get(), capacity);
+            return buffer;
+        }
+    }
+    buffer = AllocateBuffer(capacity);
+    if (buffer == nullptr) {
+        APP_LOGE("allocate packing buffer %{public}d failed", static_cast<int32_t>(capacity));
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    TrackLocked(buffer.get(), capacity);
+    UpdateHighWaterLocked();
+    return buffer;
+}
+
+void PackingBufferPool::Release(std::unique_ptr<uint8_t[]> buffer)
+{
+    if (buffer == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto item = outstanding_.find(buffer.get());
+    if (item == outstanding_.end()) {
+        return;
+    }
+    size_t capacity = item->second;
+    outstanding_.erase(item);
+    stats_.outstandingBytes -= capacity;
+    // buffers of an outdated size are dropped so the pool follows the learnt size
+    if (pooled_.size() >= maxPooledBuffers_ || capacity < GetBufferSizeLocked()) {
+        return;
+    }
+    pooled_.emplace_back(std::move(buffer), capacity);
+    stats_.pooledBytes += capacity;
+}
+
+void PackingBufferPool::RecordPackedSize(size_t packedSize)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    maxPackedSize_ = std::max(maxPackedSize_, packedSize);
+}
+
+size_t PackingBufferPool::GetMaxBufferSize() const
+{
+    return maxBufferSize_;
+}
+
+PackingBufferPoolStats PackingBufferPool::GetStats()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    PackingBufferPoolStats stats = stats_;
+    stats.bufferSize = GetBufferSizeLocked();
+    return stats;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base64_util.h"
+
+using namespace OHOS::AppExecFwk;
+
+namespace {
+constexpr int64_t MIN_ICON_SIZE = 1024;
+constexpr int64_t MAX_ICON_SIZE = 2 * 1024 * 1024;
+constexpr int32_t RANGE_MULTIPLIER = 4;
+const std::vector<char> DECODE_TABLE = {
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
+    'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
+    'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm',
+    'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
+};
+
+std::vector<uint8_t> CreateIcon(size_t size)
+{
+    std::vector<uint8_t> icon(size);
+    uint32_t seed = 0x2545F491;
+    for (auto &byte : icon) {
+        seed = seed * 1103515245 + 12345;
+        byte = static_cast<uint8_t>(seed >> 16);
+    }
+    return icon;
+}
+
+// byte-at-a-time loop formerly used by DistributedBms::EncodeBase64, kept as the baseline
+std::unique_ptr<char[]> LegacyEncodeBase64(const uint8_t *srcData, int srcLen)
+{
+    int len = (srcLen / 3) * 4;
+    int outLen = ((srcLen % 3) != 0) ? (len + 4) : len;
+    std::unique_ptr<char[]> result = std::make_unique<char[]>(outLen + 1);
+    char *dstData = result.get();
+    int j = 0;
+    int i = 0;
+    for (; i < srcLen - 3; i += 3) {
+        unsigned char byte1 = srcData[i];
+        unsigned char byte2 = srcData[i + 1];
+        unsigned char byte3 = srcData[i + 2];
+        dstData[j++] = DECODE_TABLE[byte1 >> 2];
+        dstData[j++] = DECODE_TABLE[(static_cast<uint8_t>(byte1 & 3) << 4) | (byte2 >> 4)];
+        dstData[j++] = DECODE_TABLE[(static_cast<uint8_t>(byte2 & 15) << 2) | (byte3 >> 6)];
+        dstData[j++] = DECODE_TABLE[byte3 & 63];
+    }
+    if (srcLen % 3 == 1) {
+        unsigned char byte1 = srcData[i];
+        dstData[j++] = DECODE_TABLE[byte1 >> 2];
+        dstData[j++] = DECODE_TABLE[static_cast<uint8_t>(byte1 & 3) << 4];
+        dstData[j++] = '=';
+        dstData[j++] = '=';
+    } else {
+        unsigned char byte1 = srcData[i];
+        unsigned char byte2 = srcData[i + 1];
+        dstData[j++] = DECODE_TABLE[byte1 >> 2];
+        dstData[j++] = DECODE_TABLE[(static_cast<uint8_t>(byte1 & 3) << 4) | (byte2 >> 4)];
+        dstData[j++] = DECODE_TABLE[static_cast<uint8_t>(byte2 & 15) << 2];
+        dstData[j++] = '=';
+    }
+    dstData[outLen] = '\0';
+    return result;
+}
+
+void BenchmarkLegacyEncode(benchmark::State &state)
+{
+    // use a length not divisible by 3, the legacy loop drops the last byte otherwise
+    std::vector<uint8_t> icon = CreateIcon(static_cast<size_t>(state.range(0)) + 1);
+    for (auto _ : state) {
+        auto result = LegacyEncodeBase64(icon.data(), static_cast<int>(icon.size()));
+        benchmark::DoNotOptimize(result.get());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(icon.size()));
+}
+
+void BenchmarkEncode(benchmark::State &state, Base64EncoderType type)
+{
+    if (!Base64Util::IsEncoderSupported(type)) {
+        state.SkipWithError("encoder not supported on this cpu");
+        return;
+    }
+    std::vector<uint8_t> icon = CreateIcon(static_cast<size_t>(state.range(0)) + 1);
+    std::string result(Base64Util::GetEncodedLength(icon.size()), '\0');
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Base64Util::Encode(icon.data(), icon.size(), result.data(), type));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(icon.size()));
+}
+
+void BenchmarkScalarEncode(benchmark::State &state)
+{
+    BenchmarkEncode(state, Base64EncoderType::SCALAR);
+}
+
+void BenchmarkSsse3Encode(benchmark::State &state)
+{
+    BenchmarkEncode(state, Base64EncoderType::SSSE3);
+}
+
+void BenchmarkAvx2Encode(benchmark::State &state)
+{
+    BenchmarkEncode(state, Base64EncoderType::AVX2);
+}
+
+void BenchmarkNeonEncode(benchmark::State &state)
+{
+    BenchmarkEncode(state, Base64EncoderType::NEON);
+}
+
+void BenchmarkDispatchedEncode(benchmark::State &state)
+{
+    BenchmarkEncode(state, Base64Util::GetEncoderType());
+}
+}
+
+BENCHMARK(BenchmarkLegacyEncode)->RangeMultiplier(RANGE_MULTIPLIER)->Range(MIN_ICON_SIZE, MAX_ICON_SIZE);
+BENCHMARK(BenchmarkScalarEncode)->RangeMultiplier(RANGE_MULTIPLIER)->Range(MIN_ICON_SIZE, MAX_ICON_SIZE);
+BENCHMARK(BenchmarkSsse3Encode)->RangeMultiplier(RANGE_MULTIPLIER)->Range(MIN_ICON_SIZE, MAX_ICON_SIZE);
+BENCHMARK(BenchmarkAvx2Encode)->RangeMultiplier(RANGE_MULTIPLIER)->Range(MIN_ICON_SIZE, MAX_ICON_SIZE);
+BENCHMARK(BenchmarkNeonEncode)->RangeMultiplier(RANGE_MULTIPLIER)->Range(MIN_ICON_SIZE, MAX_ICON_SIZE);
+BENCHMARK(BenchmarkDispatchedEncode)->RangeMultiplier(RANGE_MULTIPLIER)->Range(MIN_ICON_SIZE, MAX_ICON_SIZE);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "distributed_bundle_info_codec.h"
+
+using namespace OHOS::AppExecFwk;
+
+namespace {
+const std::string BUNDLE_NAME_PREFIX = "com.example.bundle";
+const std::string MODULE_NAME = "entry";
+const std::string ABILITY_NAME_PREFIX = "Ability";
+constexpr int32_t ABILITY_COUNT = 4;
+constexpr int32_t MODULE_COUNT = 3;
+const std::vector<std::string> PERMISSIONS = {
+    "ohos.permission.INTERNET",
+    "ohos.permission.DISTRIBUTED_DATASYNC",
+    "ohos.permission.GET_BUNDLE_INFO",
+};
+
+DistributedBundleInfo CreateDistributedBundleInfo()
+{
+    DistributedBundleInfo distributedBundleInfo;
+    distributedBundleInfo.bundleName = BUNDLE_NAME_PREFIX;
+    distributedBundleInfo.versionName = "1.0.0";
+    distributedBundleInfo.versionCode = 1000000;
+    distributedBundleInfo.accessTokenId = 1;
+    for (int32_t module = 0; module < MODULE_COUNT; ++module) {
+        DistributedModuleInfo distributedModuleInfo;
+        distributedModuleInfo.moduleName = MODULE_NAME + std::to_string(module);
+        for (int32_t ability = 0; ability < ABILITY_COUNT; ++ability) {
+            DistributedAbilityInfo distributedAbilityInfo;
+            distributedAbilityInfo.abilityName = ABILITY_NAME_PREFIX + std::to_string(ability);
+            distributedAbilityInfo.permissions = PERMISSIONS;
+            distributedModuleInfo.abilities.emplace_back(distributedAbilityInfo);
+        }
+        distributedBundleInfo.moduleInfos.emplace_back(distributedModuleInfo);
+    }
+    return distributedBundleInfo;
+}
+
+// a value written by a device without the codec
+void BenchmarkDecodeJsonBundleInfo(benchmark::State &state)
+{
+    std::string json = CreateDistributedBundleInfo().ToString();
+    std::vector<uint8_t> value(json.begin(), json.end());
+    for (auto _ : state) {
+        DistributedBundleInfo distributedBundleInfo;
+        if (!DistributedBundleInfoCodec::Decode(value, distributedBundleInfo)) {
+            state.SkipWithError("decode json failed");
+            return;
+        }
+        benchmark::DoNotOptimize(distributedBundleInfo.moduleInfos.data());
+    }
+    state.counters["valueSize"] = static_cast<double>(value.size());
+}
+
+void BenchmarkDecodeCompactBundleInfo(benchmark::State &state)
+{
+    std::vector<uint8_t> value = DistributedBundleInfoCodec::Encode(CreateDistributedBundleInfo());
+    for (auto _ : state) {
+        DistributedBundleInfo distributedBundleInfo;
+        if (!DistributedBundleInfoCodec::Decode(value, distributedBundleInfo)) {
+            state.SkipWithError("decode record failed");
+            return;
+        }
+        benchmark::DoNotOptimize(distributedBundleInfo.moduleInfos.data());
+    }
+    state.counters["valueSize"] = static_cast<double>(value.size());
+}
+}
+
+BENCHMARK(BenchmarkDecodeJsonBundleInfo)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BenchmarkDecodeCompactBundleInfo)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
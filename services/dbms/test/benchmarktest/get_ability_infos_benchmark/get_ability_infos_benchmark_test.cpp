@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define private public
+#include "distributed_bms.h"
+#undef private
+#include "dbms_icon_cache.h"
+#include "dbms_icon_store.h"
+#include "dbms_label_cache.h"
+#include "iremote_stub.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+const std::string BUNDLE_NAME = "com.example.benchmark";
+const std::string MODULE_NAME = "entry";
+const std::string ABILITY_NAME_PREFIX = "Ability";
+const std::string LABEL = "label";
+constexpr int32_t QUERY_LATENCY_MS = 2;
+constexpr int32_t LABEL_LATENCY_MS = 1;
+constexpr int32_t MEDIA_LATENCY_MS = 3;
+// the last ability of a batch is this many times slower, the batch should take about as long as it
+constexpr int32_t SLOWEST_FACTOR = 3;
+constexpr int32_t ICON_SIZE = 1024;
+constexpr int32_t MIN_BATCH_SIZE = 1;
+constexpr int32_t MID_BATCH_SIZE = 4;
+constexpr int32_t MAX_BATCH_SIZE = 10;
+const std::vector<uint8_t> PNG_MAGIC = { 0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A };
+
+// stands in for the bundle manager service, each call costs roughly one local IPC plus the resource lookup
+class MockBundleMgr : public IRemoteStub<IBundleMgr> {
+public:
+    ErrCode QueryAbilityInfosV9(const AAFwk::Want &want, int32_t flags, int32_t userId,
+        std::vector<AbilityInfo> &abilityInfos) override
+    {
+        std::string abilityName = want.GetElement().GetAbilityName();
+        Sleep(abilityName, QUERY_LATENCY_MS);
+        AbilityInfo abilityInfo;
+        abilityInfo.bundleName = want.GetElement().GetBundleName();
+        abilityInfo.moduleName = MODULE_NAME;
+        abilityInfo.name = abilityName;
+        abilityInfo.labelId = 1;
+        abilityInfo.iconId = 1;
+        abilityInfos.emplace_back(abilityInfo);
+        return ERR_OK;
+    }
+
+    ErrCode GetBundleInfoV9(const std::string &bundleName, int32_t flags, BundleInfo &bundleInfo,
+        int32_t userId) override
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(QUERY_LATENCY_MS));
+        bundleInfo.name = bundleName;
+        for (int32_t i = 0; i < MAX_BATCH_SIZE; ++i) {
+            AbilityInfo abilityInfo;
+            abilityInfo.bundleName = bundleName;
+            abilityInfo.moduleName = MODULE_NAME;
+            abilityInfo.name = ABILITY_NAME_PREFIX + std::to_string(i);
+            abilityInfo.labelId = static_cast<uint32_t>(i);
+            // the abilities share one icon, like the entries of most bundles
+            abilityInfo.iconId = 1;
+            bundleInfo.abilityInfos.emplace_back(abilityInfo);
+        }
+        return ERR_OK;
+    }
+
+    std::string GetStringById(const std::string &bundleName, const std::string &moduleName, uint32_t resId,
+        int32_t userId, const std::string &localeInfo) override
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(LABEL_LATENCY_MS));
+        return LABEL;
+    }
+
+    ErrCode GetMediaData(const std::string &bundleName, const std::string &moduleName,
+        const std::string &abilityName, std::unique_ptr<uint8_t[]> &mediaDataPtr, size_t &len,
+        int32_t userId) override
+    {
+        Sleep(abilityName, MEDIA_LATENCY_MS);
+        len = ICON_SIZE;
+        mediaDataPtr = std::make_unique<uint8_t[]>(len);
+        std::copy(PNG_MAGIC.begin(), PNG_MAGIC.end(), mediaDataPtr.get());
+        return ERR_OK;
+    }
+
+    std::string slowestAbilityName;
+
+private:
+    void Sleep(const std::string &abilityName, int32_t latency) const
+    {
+        int32_t factor = abilityName == slowestAbilityName ? SLOWEST_FACTOR : 1;
+        std::this_thread::sleep_for(std::chrono::milliseconds(latency * factor));
+    }
+};
+
+// every iteration resolves from scratch, otherwise the comparison mostly measures cache hits
+void ClearCaches()
+{
+    DbmsIconCache::GetInstance()->Clear();
+    DbmsLabelCache::GetInstance()->Clear();
+    DbmsIconStore::GetInstance()->Clear();
+}
+
+std::vector<ElementName> CreateElementNames(int64_t count)
+{
+    std::vector<ElementName> elementNames;
+    for (int64_t i = 0; i < count; ++i) {
+        elementNames.emplace_back("", BUNDLE_NAME, ABILITY_NAME_PREFIX + std::to_string(i), MODULE_NAME);
+    }
+    return elementNames;
+}
+
+std::shared_ptr<DistributedBms> CreateDistributedBms(const std::vector<ElementName> &elementNames)
+{
+    auto distributedBms = DelayedSingleton<DistributedBms>::GetInstance();
+    sptr<MockBundleMgr> bundleMgr = new (std::nothrow) MockBundleMgr();
+    if (bundleMgr != nullptr && !elementNames.empty()) {
+        bundleMgr->slowestAbilityName = elementNames.back().GetAbilityName();
+    }
+    distributedBms->bundleMgr_ = bundleMgr;
+    return distributedBms;
+}
+
+// one element at a time, the way the batch was resolved before the worker pool and the bundle grouping
+void BenchmarkSerialGetAbilityInfos(benchmark::State &state)
+{
+    std::vector<ElementName> elementNames = CreateElementNames(state.range(0));
+    auto distributedBms = CreateDistributedBms(elementNames);
+    for (auto _ : state) {
+        state.PauseTiming();
+        ClearCaches();
+        state.ResumeTiming();
+        std::vector<RemoteAbilityInfo> remoteAbilityInfos;
+        for (const auto &elementName : elementNames) {
+            RemoteAbilityInfo remoteAbilityInfo;
+            if (distributedBms->ResolveAbilityInfo(elementName, "", remoteAbilityInfo) != ERR_OK) {
+                state.SkipWithError("resolve ability info failed");
+                return;
+            }
+            remoteAbilityInfos.emplace_back(std::move(remoteAbilityInfo));
+        }
+        benchmark::DoNotOptimize(remoteAbilityInfos.data());
+    }
+    distributedBms->bundleMgr_ = nullptr;
+}
+
+void BenchmarkParallelGetAbilityInfos(benchmark::State &state)
+{
+    std::vector<ElementName> elementNames = CreateElementNames(state.range(0));
+    auto distributedBms = CreateDistributedBms(elementNames);
+    for (auto _ : state) {
+        state.PauseTiming();
+        ClearCaches();
+        state.ResumeTiming();
+        std::vector<RemoteAbilityInfo> remoteAbilityInfos;
+        if (distributedBms->ResolveAbilityInfos(elementNames, "", remoteAbilityInfos) != ERR_OK) {
+            state.SkipWithError("resolve ability infos failed");
+            return;
+        }
+        benchmark::DoNotOptimize(remoteAbilityInfos.data());
+    }
+    distributedBms->bundleMgr_ = nullptr;
+}
+
+// the slowest element alone, the lower bound of the parallel batch
+void BenchmarkSlowestGetAbilityInfo(benchmark::State &state)
+{
+    std::vector<ElementName> elementNames = CreateElementNames(MAX_BATCH_SIZE);
+    auto distributedBms = CreateDistributedBms(elementNames);
+    for (auto _ : state) {
+        state.PauseTiming();
+        ClearCaches();
+        state.ResumeTiming();
+        RemoteAbilityInfo remoteAbilityInfo;
+        if (distributedBms->ResolveAbilityInfo(elementNames.back(), "", remoteAbilityInfo) != ERR_OK) {
+            state.SkipWithError("resolve ability info failed");
+            return;
+        }
+        benchmark::DoNotOptimize(remoteAbilityInfo.label.data());
+    }
+    distributedBms->bundleMgr_ = nullptr;
+}
+}
+
+BENCHMARK(BenchmarkSerialGetAbilityInfos)->Arg(MIN_BATCH_SIZE)->Arg(MID_BATCH_SIZE)->Arg(MAX_BATCH_SIZE)
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BenchmarkParallelGetAbilityInfos)->Arg(MIN_BATCH_SIZE)->Arg(MID_BATCH_SIZE)->Arg(MAX_BATCH_SIZE)
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BenchmarkSlowestGetAbilityInfo)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
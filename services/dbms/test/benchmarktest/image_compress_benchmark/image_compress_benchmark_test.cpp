@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <dirent.h>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "image_compress.h"
+#include "packing_buffer_pool.h"
+
+using namespace OHOS::AppExecFwk;
+
+namespace {
+// real launcher icons, png and jpeg of 114*114 up to 1024*1024
+const std::string ICON_DIR = "/data/test/resource/dbms/icons/";
+const std::string CLEAR_REFS_PATH = "/proc/self/clear_refs";
+const std::string STATUS_PATH = "/proc/self/status";
+const std::string RESET_PEAK_RSS = "5";
+const std::string PEAK_RSS_TAG = "VmHWM:";
+
+struct IconFile {
+    std::string name;
+    std::unique_ptr<uint8_t[]> data;
+    size_t size = 0;
+};
+
+std::vector<IconFile> LoadIcons()
+{
+    std::vector<IconFile> icons;
+    DIR *dir = opendir(ICON_DIR.c_str());
+    if (dir == nullptr) {
+        return icons;
+    }
+    struct dirent *entry = nullptr;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (entry->d_type != DT_REG) {
+            continue;
+        }
+        std::ifstream file(ICON_DIR + entry->d_name, std::ios::binary | std::ios::ate);
+        std::streamsize size = file.tellg();
+        if (size <= 0) {
+            continue;
+        }
+        IconFile icon;
+        icon.name = entry->d_name;
+        icon.size = static_cast<size_t>(size);
+        icon.data = std::make_unique<uint8_t[]>(icon.size);
+        file.seekg(0);
+        file.read(reinterpret_cast<char *>(icon.data.get()), size);
+        icons.emplace_back(std::move(icon));
+    }
+    closedir(dir);
+    return icons;
+}
+
+const std::vector<IconFile> &GetIcons()
+{
+    static const std::vector<IconFile> icons = LoadIcons();
+    return icons;
+}
+
+void ResetPeakRss()
+{
+    std::ofstream clearRefs(CLEAR_REFS_PATH);
+    clearRefs << RESET_PEAK_RSS;
+}
+
+int64_t GetPeakRssKb()
+{
+    std::ifstream status(STATUS_PATH);
+    std::string tag;
+    while (status >> tag) {
+        if (tag == PEAK_RSS_TAG) {
+            int64_t value = 0;
+            status >> value;
+            return value;
+        }
+    }
+    return 0;
+}
+
+void BenchmarkCompress(benchmark::State &state, bool decodeScaleEnabled)
+{
+    const auto &icons = GetIcons();
+    size_t index = static_cast<size_t>(state.range(0));
+    if (index >= icons.size()) {
+        state.SkipWithError("icon not found");
+        return;
+    }
+    const IconFile &icon = icons[index];
+    state.SetLabel(icon.name);
+    ImageCompress imageCompress;
+    imageCompress.SetDecodeScaleEnabled(decodeScaleEnabled);
+    int64_t baseRss = GetPeakRssKb();
+    ResetPeakRss();
+    int64_t compressedSize = 0;
+    for (auto _ : state) {
+        std::unique_ptr<uint8_t[]> compressedData;
+        std::string imageType;
+        if (!imageCompress.CompressImageByContent(icon.data, icon.size, compressedData, compressedSize, imageType)) {
+            state.SkipWithError("CompressImageByContent failed");
+            return;
+        }
+        benchmark::DoNotOptimize(compressedData.get());
+        imageCompress.ReleaseCompressedData(compressedData);
+    }
+    PackingBufferPoolStats poolStats = PackingBufferPool::GetInstance()->GetStats();
+    state.counters["pool_hit_rate"] = poolStats.acquireCount == 0 ? 0.0 :
+        static_cast<double>(poolStats.hitCount) / poolStats.acquireCount;
+    state.counters["pool_high_water_bytes"] = static_cast<double>(poolStats.highWaterBytes);
+    state.counters["peak_rss_kb"] = static_cast<double>(GetPeakRssKb());
+    state.counters["base_rss_kb"] = static_cast<double>(baseRss);
+    state.counters["compressed_bytes"] = static_cast<double>(compressedSize);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(icon.size));
+}
+
+void BenchmarkScaleAfterDecode(benchmark::State &state)
+{
+    BenchmarkCompress(state, false);
+}
+
+void BenchmarkScaleOnDecode(benchmark::State &state)
+{
+    BenchmarkCompress(state, true);
+}
+
+void IconArguments(benchmark::internal::Benchmark *benchmark)
+{
+    size_t count = GetIcons().size();
+    for (size_t i = 0; i < count; i++) {
+        benchmark->Arg(static_cast<int64_t>(i));
+    }
+}
+}
+
+BENCHMARK(BenchmarkScaleAfterDecode)->Apply(IconArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BenchmarkScaleOnDecode)->Apply(IconArguments)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
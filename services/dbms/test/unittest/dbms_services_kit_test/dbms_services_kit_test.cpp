@@ -15,36 +15,57 @@
 
 #define private public
 
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <gtest/gtest.h>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <fcntl.h>
 #include <future>
 
 #include "accesstoken_kit.h"
+#include "account_manager_helper.h"
 #include "appexecfwk_errors.h"
+#include "base64_util.h"
 #include "bundle_installer_proxy.h"
 #include "bundle_mgr_proxy.h"
+#include "dbms_acl_cache.h"
+#include "dbms_acl_info_cache.h"
+#include "dbms_bundle_name_index.h"
 #include "dbms_device_manager.h"
+#include "dbms_icon_cache.h"
+#include "dbms_icon_store.h"
+#include "dbms_label_cache.h"
+#include "dbms_query_session.h"
+#include "dbms_remote_proxy_cache.h"
+#include "dbms_single_flight.h"
+#include "dbms_task_pool.h"
 #include "distributed_ability_info.h"
 #include "distributed_bms_acl_info.h"
+#include "distributed_bms_callback_stub.h"
+#include "distributed_bms_deadline.h"
 #include "distributed_bms.h"
 #include "distributed_bms_interface.h"
 #include "distributed_bms_proxy.h"
 #include "distributed_bundle_info.h"
+#include "distributed_bundle_info_codec.h"
 #include "distributed_module_info.h"
 #include "element_name.h"
 #include "event_report.h"
 #ifdef DISTRIBUTED_BUNDLE_IMAGE_ENABLE
 #include "image_compress.h"
+#include "packing_buffer_pool.h"
 #endif
 #include "iservice_registry.h"
 #include "json_util.h"
 #include "mock_scope_guard.h"
 #include "nativetoken_kit.h"
 #include "token_setproc.h"
+#include "remote_ability_binary_info.h"
+#include "remote_ability_conditional_info.h"
+#include "remote_ability_info_result.h"
 #include "service_control.h"
 #include "softbus_common.h"
 #include "status_receiver_host.h"
@@ -68,6 +89,8 @@ const std::string HAP_FILE_PATH =
     "/data/app/el1/bundle/public/com.example.test/entry.hap";
 const std::string PATH_LOCATION = "/data/app/el1/bundle/public/com.query.test";
 const std::string PATH_LOCATIONS = "/data/app/el1/bundle/new_create.txt";
+const std::string ICON_STORE_TEST_DIR = "/data/test/dbms_icons";
+constexpr size_t ICON_STORE_TEST_CAPACITY = 1024 * 1024;
 const std::string DEVICE_ID_NORMAL = "deviceId";
 const std::string LOCALE_INFO = "localeInfo";
 const std::string EMPTY_STRING = "";
@@ -75,6 +98,18 @@ const int32_t USERID = 100;
 const std::string MSG_SUCCESS = "[SUCCESS]";
 const std::string OPERATION_FAILED = "Failure";
 const std::string OPERATION_SUCCESS = "Success";
+
+std::shared_ptr<const IconData> CreateIconData(const std::string &content)
+{
+    auto icon = std::make_shared<IconData>();
+    icon->Assign(reinterpret_cast<const uint8_t *>(content.data()), content.size());
+    return icon;
+}
+
+std::string IconDataToString(const IconData &icon)
+{
+    return std::string(reinterpret_cast<const char *>(icon.data.get()), icon.size);
+}
 }  // namespace
 
 class StatusReceiverImpl : public StatusReceiverHost {
@@ -1575,4 +1610,1369 @@ HWTEST_F(DbmsServicesKitTest, GetBundleVersionCode_0040, Function | SmallTest |
         EXPECT_EQ(ret, ERR_BUNDLE_MANAGER_PERMISSION_DENIED);
     }
 }
-} // OHOS
\ No newline at end of file
+
+/**
+ * @tc.number: Base64Util_0010
+ * @tc.name: Encode
+ * @tc.desc: Test Base64Util Encode with rfc4648 test vectors
+ */
+HWTEST_F(DbmsServicesKitTest, Base64Util_0010, Function | SmallTest | TestSize.Level0)
+{
+    const std::vector<std::pair<std::string, std::string>> vectors = {
+        {"f", "Zg=="}, {"fo", "Zm8="}, {"foo", "Zm9v"}, {"foob", "Zm9vYg=="},
+        {"fooba", "Zm9vYmE="}, {"foobar", "Zm9vYmFy"}
+    };
+    for (const auto &item : vectors) {
+        std::string encoded(Base64Util::GetEncodedLength(item.first.size()), '\0');
+        size_t len = Base64Util::Encode(reinterpret_cast<const uint8_t *>(item.first.data()), item.first.size(),
+            encoded.data());
+        EXPECT_EQ(len, item.second.size());
+        EXPECT_EQ(encoded, item.second);
+    }
+    char dst[1] = {0};
+    EXPECT_EQ(Base64Util::Encode(nullptr, 0, dst), 0);
+}
+
+/**
+ * @tc.number: Base64Util_0020
+ * @tc.name: Encode
+ * @tc.desc: Test every supported encoder produces the same output as the scalar one
+ */
+HWTEST_F(DbmsServicesKitTest, Base64Util_0020, Function | SmallTest | TestSize.Level0)
+{
+    const size_t maxLen = 1024;
+    std::vector<uint8_t> src(maxLen);
+    for (size_t i = 0; i < maxLen; i++) {
+        src[i] = static_cast<uint8_t>(i * 131 + 7);
+    }
+    const std::vector<Base64EncoderType> types = {
+        Base64EncoderType::SSSE3, Base64EncoderType::AVX2, Base64EncoderType::NEON
+    };
+    for (size_t len = 1; len <= maxLen; len++) {
+        std::string expected(Base64Util::GetEncodedLength(len), '\0');
+        Base64Util::Encode(src.data(), len, expected.data(), Base64EncoderType::SCALAR);
+        for (auto type : types) {
+            std::string encoded(Base64Util::GetEncodedLength(len), '\0');
+            size_t encodedLen = Base64Util::Encode(src.data(), len, encoded.data(), type);
+            EXPECT_EQ(encodedLen, expected.size());
+            EXPECT_EQ(encoded, expected);
+        }
+    }
+}
+
+/**
+ * @tc.number: GetMediaBase64_0010
+ * @tc.name: GetMediaBase64
+ * @tc.desc: Test GetMediaBase64 builds data uri
+ */
+HWTEST_F(DbmsServicesKitTest, GetMediaBase64_0010, Function | SmallTest | TestSize.Level0)
+{
+    auto distributedBms = GetDistributedBms();
+    EXPECT_NE(distributedBms, nullptr);
+    if (distributedBms != nullptr) {
+        const int64_t len = 3;
+        std::unique_ptr<uint8_t[]> data = std::make_unique<uint8_t[]>(len);
+        data[0] = 'f';
+        data[1] = 'o';
+        data[2] = 'o';
+        std::string imageType = "image/png";
+        std::string value;
+        EXPECT_TRUE(distributedBms->GetMediaBase64(data.get(), len, imageType, value));
+        EXPECT_EQ(value, "data:image/png;base64,Zm9v");
+        EXPECT_FALSE(distributedBms->GetMediaBase64(data.get(), 0, imageType, value));
+    }
+}
+
+/**
+ * @tc.number: DbmsIconCache_0010
+ * @tc.name: Get and Put
+ * @tc.desc: Test the least recently used icon is evicted when over capacity
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsIconCache_0010, Function | SmallTest | TestSize.Level0)
+{
+    const size_t capacity = 10;
+    DbmsIconCache iconCache(capacity);
+    IconCacheKey first { BUNDLE_NAME, MODULE_NAME, ABILITY_NAME, USERID, 1, 1 };
+    IconCacheKey second { BUNDLE_NAME, MODULE_NAME, WRONG_ABILITY_NAME, USERID, 1, 1 };
+    IconCacheKey third { INVALID_NAME, MODULE_NAME, ABILITY_NAME, USERID, 1, 1 };
+    iconCache.Put(first, CreateIconData("icon1"));
+    iconCache.Put(second, CreateIconData("icon2"));
+    std::shared_ptr<const IconData> icon;
+    EXPECT_TRUE(iconCache.Get(first, icon));
+    ASSERT_NE(icon, nullptr);
+    EXPECT_EQ(IconDataToString(*icon), "icon1");
+    iconCache.Put(third, CreateIconData("icon3"));
+    EXPECT_FALSE(iconCache.Get(second, icon));
+    EXPECT_TRUE(iconCache.Get(first, icon));
+    EXPECT_TRUE(iconCache.Get(third, icon));
+    EXPECT_EQ(IconDataToString(*icon), "icon3");
+    EXPECT_EQ(iconCache.GetSize(), capacity);
+
+    IconCacheKey otherUser = first;
+    otherUser.userId = USERID + 1;
+    EXPECT_FALSE(iconCache.Get(otherUser, icon));
+    IconCacheKey otherVersion = first;
+    otherVersion.versionCode = 2;
+    EXPECT_FALSE(iconCache.Get(otherVersion, icon));
+    IconCacheKey otherEdge = first;
+    otherEdge.maxIconEdge = 48;
+    EXPECT_FALSE(iconCache.Get(otherEdge, icon));
+
+    iconCache.Put(first, CreateIconData(std::string(capacity + 1, 'x')));
+    EXPECT_TRUE(iconCache.Get(first, icon));
+    EXPECT_EQ(IconDataToString(*icon), "icon1");
+}
+
+/**
+ * @tc.number: DbmsIconCache_0020
+ * @tc.name: Invalidate
+ * @tc.desc: Test all icons of a bundle are dropped on invalidate
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsIconCache_0020, Function | SmallTest | TestSize.Level0)
+{
+    DbmsIconCache iconCache(1024);
+    IconCacheKey first { BUNDLE_NAME, MODULE_NAME, ABILITY_NAME, USERID, 1, 1 };
+    IconCacheKey second { BUNDLE_NAME, MODULE_NAME, WRONG_ABILITY_NAME, USERID, 1, 1 };
+    IconCacheKey third { INVALID_NAME, MODULE_NAME, ABILITY_NAME, USERID, 1, 1 };
+    iconCache.Put(first, CreateIconData("icon1"));
+    iconCache.Put(second, CreateIconData("icon2"));
+    iconCache.Put(third, CreateIconData("icon3"));
+    iconCache.Invalidate(BUNDLE_NAME);
+    std::shared_ptr<const IconData> icon;
+    EXPECT_FALSE(iconCache.Get(first, icon));
+    EXPECT_FALSE(iconCache.Get(second, icon));
+    EXPECT_TRUE(iconCache.Get(third, icon));
+    iconCache.Clear();
+    EXPECT_FALSE(iconCache.Get(third, icon));
+    EXPECT_EQ(iconCache.GetSize(), 0);
+}
+
+#ifdef DISTRIBUTED_BUNDLE_IMAGE_ENABLE
+/**
+ * @tc.number: PackingBufferPool_0010
+ * @tc.name: Acquire and Release
+ * @tc.desc: Test released buffers are reused and counted as hits
+ */
+HWTEST_F(DbmsServicesKitTest, PackingBufferPool_0010, Function | SmallTest | TestSize.Level0)
+{
+    const size_t minSize = 1024;
+    const size_t maxSize = 8192;
+    PackingBufferPool bufferPool(minSize, maxSize, 2);
+    size_t capacity = 0;
+    std::unique_ptr<uint8_t[]> buffer = bufferPool.Acquire(0, capacity);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(capacity, minSize);
+    uint8_t *address = buffer.get();
+    bufferPool.Release(std::move(buffer));
+    buffer = bufferPool.Acquire(0, capacity);
+    EXPECT_EQ(buffer.get(), address);
+    PackingBufferPoolStats stats = bufferPool.GetStats();
+    EXPECT_EQ(stats.acquireCount, 2);
+    EXPECT_EQ(stats.hitCount, 1);
+    EXPECT_EQ(stats.outstandingBytes, minSize);
+    EXPECT_EQ(stats.highWaterBytes, minSize);
+    bufferPool.Release(std::move(buffer));
+    bufferPool.Release(std::make_unique<uint8_t[]>(minSize));
+    stats = bufferPool.GetStats();
+    EXPECT_EQ(stats.pooledBytes, minSize);
+    EXPECT_EQ(stats.outstandingBytes, 0);
+}
+
+/**
+ * @tc.number: PackingBufferPool_0020
+ * @tc.name: RecordPackedSize
+ * @tc.desc: Test the buffer size follows the packed sizes and is capped
+ */
+HWTEST_F(DbmsServicesKitTest, PackingBufferPool_0020, Function | SmallTest | TestSize.Level0)
+{
+    const size_t minSize = 1024;
+    const size_t maxSize = 8192;
+    PackingBufferPool bufferPool(minSize, maxSize, 2);
+    size_t capacity = 0;
+    std::unique_ptr<uint8_t[]> buffer = bufferPool.Acquire(0, capacity);
+    bufferPool.RecordPackedSize(minSize - 1);
+    bufferPool.Release(std::move(buffer));
+    PackingBufferPoolStats stats = bufferPool.GetStats();
+    EXPECT_EQ(stats.bufferSize, minSize * 2);
+    EXPECT_EQ(stats.pooledBytes, 0);
+    buffer = bufferPool.Acquire(0, capacity);
+    EXPECT_EQ(capacity, minSize * 2);
+    std::unique_ptr<uint8_t[]> largest = bufferPool.Acquire(maxSize, capacity);
+    EXPECT_EQ(capacity, maxSize);
+    bufferPool.RecordPackedSize(maxSize * 2);
+    EXPECT_EQ(bufferPool.GetStats().bufferSize, maxSize);
+    EXPECT_EQ(bufferPool.GetMaxBufferSize(), maxSize);
+}
+#endif
+
+#ifdef DISTRIBUTED_BUNDLE_IMAGE_ENABLE
+/**
+ * @tc.number: PackingBufferPool_0030
+ * @tc.name: GetAbilityIconData
+ * @tc.desc: Test a packed icon kept by the icon cache holds no packing buffer
+ */
+HWTEST_F(DbmsServicesKitTest, PackingBufferPool_0030, Function | SmallTest | TestSize.Level0)
+{
+    ASSERT_TRUE(InstallBundle(SYSTEM_HAP_FILE_PATH));
+    auto distributedBms = GetDistributedBms();
+    ASSERT_NE(distributedBms, nullptr);
+    std::vector<PrecomputedAbilityInfo> infos;
+    EXPECT_TRUE(distributedBms->PrecomputeAbilityInfos(BUNDLE_NAME, USERID, infos));
+    ASSERT_FALSE(infos.empty());
+    AbilityInfo abilityInfo;
+    abilityInfo.bundleName = BUNDLE_NAME;
+    abilityInfo.moduleName = infos[0].moduleName;
+    abilityInfo.name = infos[0].abilityName;
+    auto iconCache = DbmsIconCache::GetInstance();
+    iconCache->Clear();
+    // a small edge makes the icon packed
+    constexpr int32_t maxIconEdge = 16;
+    std::shared_ptr<const IconData> iconData;
+    EXPECT_EQ(distributedBms->GetAbilityIconData(abilityInfo, USERID, iconData, maxIconEdge), OHOS::NO_ERROR);
+    ASSERT_NE(iconData, nullptr);
+    EXPECT_GT(iconData->size, 0);
+    EXPECT_GT(iconCache->GetSize(), 0);
+    EXPECT_EQ(PackingBufferPool::GetInstance()->GetStats().outstandingBytes, 0);
+    iconCache->Clear();
+    EXPECT_TRUE(UninstallBundle(BUNDLE_NAME));
+}
+#endif
+
+/**
+ * @tc.number: Base64Util_0030
+ * @tc.name: Decode
+ * @tc.desc: Test Base64Util Decode reverses Encode and rejects malformed input
+ */
+HWTEST_F(DbmsServicesKitTest, Base64Util_0030, Function | SmallTest | TestSize.Level0)
+{
+    std::vector<uint8_t> decoded;
+    EXPECT_TRUE(Base64Util::Decode("Zm9vYg==", strlen("Zm9vYg=="), decoded));
+    EXPECT_EQ(std::string(decoded.begin(), decoded.end()), "foob");
+    EXPECT_TRUE(Base64Util::Decode("Zm9vYmFy", strlen("Zm9vYmFy"), decoded));
+    EXPECT_EQ(std::string(decoded.begin(), decoded.end()), "foobar");
+    EXPECT_FALSE(Base64Util::Decode("Zm9", strlen("Zm9"), decoded));
+    EXPECT_FALSE(Base64Util::Decode("Zm!v", strlen("Zm!v"), decoded));
+}
+
+/**
+ * @tc.number: RemoteAbilityBinaryInfo_0010
+ * @tc.name: MarshallingInfos and ReadInfosFromParcel
+ * @tc.desc: Test the binary icons survive a parcel round trip in one blob, as raw data and inline
+ */
+HWTEST_F(DbmsServicesKitTest, RemoteAbilityBinaryInfo_0010, Function | SmallTest | TestSize.Level0)
+{
+    RemoteAbilityBinaryInfo info;
+    info.elementName.SetBundleName(BUNDLE_NAME);
+    info.elementName.SetAbilityName(ABILITY_NAME);
+    info.label = "label";
+    info.iconType = "image/png";
+    info.icon = { 0x89, 0x50, 0x4E, 0x47, 0x00, 0xFF };
+    RemoteAbilityBinaryInfo noIconInfo;
+    noIconInfo.elementName.SetBundleName(BUNDLE_NAME);
+    RemoteAbilityBinaryInfo otherInfo = info;
+    otherInfo.icon = { 0xFF, 0xD8, 0xFF };
+    const std::vector<RemoteAbilityBinaryInfo> infos = { info, noIconInfo, otherInfo };
+    for (bool allowRawData : { true, false }) {
+        MessageParcel parcel;
+        EXPECT_TRUE(RemoteAbilityBinaryInfo::MarshallingInfos(infos, parcel, allowRawData));
+        std::vector<RemoteAbilityBinaryInfo> results;
+        ASSERT_TRUE(RemoteAbilityBinaryInfo::ReadInfosFromParcel(parcel, results));
+        ASSERT_EQ(results.size(), infos.size());
+        for (size_t i = 0; i < infos.size(); ++i) {
+            EXPECT_EQ(results[i].elementName.GetBundleName(), infos[i].elementName.GetBundleName());
+            EXPECT_EQ(results[i].elementName.GetAbilityName(), infos[i].elementName.GetAbilityName());
+            EXPECT_EQ(results[i].label, infos[i].label);
+            EXPECT_EQ(results[i].iconType, infos[i].iconType);
+            EXPECT_EQ(results[i].icon, infos[i].icon);
+        }
+    }
+}
+
+/**
+ * @tc.number: DbmsIconStore_0010
+ * @tc.name: Save, Get and Remove
+ * @tc.desc: Test precomputed infos are read back from disk and dropped on remove
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsIconStore_0010, Function | SmallTest | TestSize.Level0)
+{
+    PrecomputedAbilityInfo info;
+    info.moduleName = MODULE_NAME;
+    info.abilityName = ABILITY_NAME;
+    info.labelId = 1;
+    info.locale = "zh-Hans";
+    info.label = "label";
+    auto icon = std::make_shared<IconData>();
+    icon->type = "image/png";
+    const std::vector<uint8_t> iconBytes = { 0x89, 0x50, 0x4E, 0x47 };
+    icon->Assign(iconBytes.data(), iconBytes.size());
+    info.icon = icon;
+    DbmsIconStore iconStore(ICON_STORE_TEST_DIR, ICON_STORE_TEST_CAPACITY);
+    EXPECT_TRUE(iconStore.Save(BUNDLE_NAME, USERID, { info }));
+
+    DbmsIconStore loadedStore(ICON_STORE_TEST_DIR, ICON_STORE_TEST_CAPACITY);
+    PrecomputedAbilityInfo result;
+    EXPECT_TRUE(loadedStore.Get(BUNDLE_NAME, "", ABILITY_NAME, USERID, result));
+    EXPECT_EQ(result.moduleName, MODULE_NAME);
+    EXPECT_EQ(result.labelId, info.labelId);
+    EXPECT_EQ(result.locale, info.locale);
+    EXPECT_EQ(result.label, info.label);
+    ASSERT_NE(result.icon, nullptr);
+    EXPECT_EQ(result.icon->type, icon->type);
+    EXPECT_EQ(IconDataToString(*result.icon), IconDataToString(*icon));
+    EXPECT_FALSE(loadedStore.Get(BUNDLE_NAME, WRONG_BUNDLE_NAME, ABILITY_NAME, USERID, result));
+
+    loadedStore.Remove(BUNDLE_NAME, USERID);
+    EXPECT_FALSE(loadedStore.Get(BUNDLE_NAME, MODULE_NAME, ABILITY_NAME, USERID, result));
+    DbmsIconStore reloadedStore(ICON_STORE_TEST_DIR, ICON_STORE_TEST_CAPACITY);
+    EXPECT_FALSE(reloadedStore.Get(BUNDLE_NAME, MODULE_NAME, ABILITY_NAME, USERID, result));
+}
+
+/**
+ * @tc.number: DbmsIconStore_0020
+ * @tc.name: Get
+ * @tc.desc: Test the bundles kept in memory fit the capacity and evicted bundles are read from disk again
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsIconStore_0020, Function | SmallTest | TestSize.Level0)
+{
+    PrecomputedAbilityInfo info;
+    info.moduleName = MODULE_NAME;
+    info.abilityName = ABILITY_NAME;
+    info.label = "label";
+    auto icon = std::make_shared<IconData>();
+    icon->type = "image/png";
+    std::vector<uint8_t> iconBytes(ICON_STORE_TEST_CAPACITY / 2, 0);
+    icon->Assign(iconBytes.data(), iconBytes.size());
+    info.icon = icon;
+    DbmsIconStore iconStore(ICON_STORE_TEST_DIR, ICON_STORE_TEST_CAPACITY);
+    EXPECT_TRUE(iconStore.Save(BUNDLE_NAME, USERID, { info }));
+    EXPECT_TRUE(iconStore.Save(WRONG_BUNDLE_NAME, USERID, { info }));
+    EXPECT_LE(iconStore.GetSize(), ICON_STORE_TEST_CAPACITY);
+
+    PrecomputedAbilityInfo result;
+    EXPECT_TRUE(iconStore.Get(BUNDLE_NAME, MODULE_NAME, ABILITY_NAME, USERID, result));
+    EXPECT_TRUE(iconStore.Get(WRONG_BUNDLE_NAME, MODULE_NAME, ABILITY_NAME, USERID, result));
+    EXPECT_LE(iconStore.GetSize(), ICON_STORE_TEST_CAPACITY);
+    iconStore.Clear();
+    EXPECT_EQ(iconStore.GetSize(), 0);
+    EXPECT_TRUE(iconStore.Get(BUNDLE_NAME, MODULE_NAME, ABILITY_NAME, USERID, result));
+
+    iconStore.Remove(BUNDLE_NAME, USERID);
+    iconStore.Remove(WRONG_BUNDLE_NAME, USERID);
+    EXPECT_FALSE(iconStore.Get(BUNDLE_NAME, MODULE_NAME, ABILITY_NAME, USERID, result));
+}
+
+/**
+ * @tc.number: DbmsIconCache_0030
+ * @tc.name: ComputeHash
+ * @tc.desc: Test the icon hash only changes with the icon content
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsIconCache_0030, Function | SmallTest | TestSize.Level0)
+{
+    IconData icon;
+    icon.type = "image/png";
+    const std::vector<uint8_t> iconBytes = { 0x01, 0x02, 0x03 };
+    icon.Assign(iconBytes.data(), iconBytes.size());
+    IconData sameIcon;
+    sameIcon.type = icon.type;
+    sameIcon.Assign(iconBytes.data(), iconBytes.size());
+    EXPECT_EQ(DbmsIconCache::ComputeHash(icon), DbmsIconCache::ComputeHash(sameIcon));
+    IconData otherData = icon;
+    const std::vector<uint8_t> otherBytes = { 0x01, 0x02, 0x04 };
+    otherData.Assign(otherBytes.data(), otherBytes.size());
+    EXPECT_NE(DbmsIconCache::ComputeHash(icon), DbmsIconCache::ComputeHash(otherData));
+    IconData otherType = icon;
+    otherType.type = "image/jpeg";
+    EXPECT_NE(DbmsIconCache::ComputeHash(icon), DbmsIconCache::ComputeHash(otherType));
+}
+
+/**
+ * @tc.number: RemoteAbilityConditionalInfo_0010
+ * @tc.name: Marshalling and Unmarshalling
+ * @tc.desc: Test a not modified info keeps its label and hash through a parcel
+ */
+HWTEST_F(DbmsServicesKitTest, RemoteAbilityConditionalInfo_0010, Function | SmallTest | TestSize.Level0)
+{
+    RemoteAbilityConditionalInfo info;
+    info.remoteAbilityInfo.elementName.SetBundleName(BUNDLE_NAME);
+    info.remoteAbilityInfo.elementName.SetAbilityName(ABILITY_NAME);
+    info.remoteAbilityInfo.label = "label";
+    info.iconHash = "0123456789abcdef-10";
+    info.iconModified = false;
+    Parcel parcel;
+    EXPECT_TRUE(info.Marshalling(parcel));
+    std::unique_ptr<RemoteAbilityConditionalInfo> result(RemoteAbilityConditionalInfo::Unmarshalling(parcel));
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->remoteAbilityInfo.elementName.GetBundleName(), BUNDLE_NAME);
+    EXPECT_EQ(result->remoteAbilityInfo.label, info.remoteAbilityInfo.label);
+    EXPECT_TRUE(result->remoteAbilityInfo.icon.empty());
+    EXPECT_EQ(result->iconHash, info.iconHash);
+    EXPECT_FALSE(result->iconModified);
+}
+
+/**
+ * @tc.number: DbmsTaskPool_0010
+ * @tc.name: ParallelFor
+ * @tc.desc: Test every index runs exactly once and the call returns after all of them
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsTaskPool_0010, Function | SmallTest | TestSize.Level0)
+{
+    DbmsTaskPool taskPool(3);
+    EXPECT_EQ(taskPool.GetThreadNum(), 3);
+    taskPool.ParallelFor(0, [](size_t) {
+        FAIL() << "no task expected";
+    });
+    constexpr size_t count = 10;
+    std::vector<int32_t> results(count, 0);
+    std::atomic<int32_t> runCount(0);
+    taskPool.ParallelFor(count, [&results, &runCount](size_t index) {
+        results[index] += static_cast<int32_t>(index);
+        runCount++;
+    });
+    EXPECT_EQ(runCount.load(), static_cast<int32_t>(count));
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(results[i], static_cast<int32_t>(i));
+    }
+}
+
+/**
+ * @tc.number: BatchGetAbilityLabelAndIcon_0010
+ * @tc.name: BatchGetAbilityLabelAndIcon
+ * @tc.desc: Test every element of a batch gets its own result in input order
+ */
+HWTEST_F(DbmsServicesKitTest, BatchGetAbilityLabelAndIcon_0010, Function | SmallTest | TestSize.Level0)
+{
+    auto distributedBms = GetDistributedBms();
+    ASSERT_NE(distributedBms, nullptr);
+    std::vector<AbilityLabelAndIcon> results;
+    distributedBms->BatchGetAbilityLabelAndIcon({}, "", results);
+    EXPECT_TRUE(results.empty());
+
+    std::vector<ElementName> elementNames;
+    elementNames.emplace_back("", WRONG_BUNDLE_NAME, WRONG_ABILITY_NAME, MODULE_NAME);
+    elementNames.emplace_back("", WRONG_BUNDLE_NAME, INVALID_NAME, MODULE_NAME);
+    elementNames.emplace_back("", BUNDLE_NAME, WRONG_ABILITY_NAME, MODULE_NAME);
+    distributedBms->BatchGetAbilityLabelAndIcon(elementNames, "", results);
+    ASSERT_EQ(results.size(), elementNames.size());
+    for (const auto &result : results) {
+        EXPECT_NE(result.result, ERR_OK);
+        EXPECT_TRUE(result.label.empty());
+        EXPECT_EQ(result.iconData, nullptr);
+    }
+}
+
+/**
+ * @tc.number: DbmsLabelCache_0010
+ * @tc.name: Get and Put
+ * @tc.desc: Test the label is cached per locale and user and the counters follow the lookups
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsLabelCache_0010, Function | SmallTest | TestSize.Level0)
+{
+    DbmsLabelCache labelCache(2);
+    LabelCacheKey key;
+    key.bundleName = BUNDLE_NAME;
+    key.moduleName = MODULE_NAME;
+    key.labelId = 1;
+    key.localeInfo = LOCALE_INFO;
+    key.userId = USERID;
+    std::string label;
+    EXPECT_FALSE(labelCache.Get(key, label));
+    labelCache.Put(key, "label");
+    EXPECT_TRUE(labelCache.Get(key, label));
+    EXPECT_EQ(label, "label");
+    LabelCacheKey otherLocale = key;
+    otherLocale.localeInfo = "en";
+    EXPECT_FALSE(labelCache.Get(otherLocale, label));
+    LabelCacheKey otherUser = key;
+    otherUser.userId = USERID + 1;
+    EXPECT_FALSE(labelCache.Get(otherUser, label));
+    labelCache.Put(otherUser, EMPTY_STRING);
+    EXPECT_EQ(labelCache.GetCount(), 1);
+    EXPECT_EQ(labelCache.GetHitCount(), 1);
+    EXPECT_EQ(labelCache.GetMissCount(), 3);
+}
+
+/**
+ * @tc.number: DbmsLabelCache_0020
+ * @tc.name: Invalidate and Clear
+ * @tc.desc: Test the least recently used label is evicted and a bundle change drops its labels
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsLabelCache_0020, Function | SmallTest | TestSize.Level0)
+{
+    DbmsLabelCache labelCache(2);
+    LabelCacheKey key;
+    key.bundleName = BUNDLE_NAME;
+    key.localeInfo = LOCALE_INFO;
+    LabelCacheKey secondKey = key;
+    secondKey.labelId = 1;
+    LabelCacheKey otherBundle = key;
+    otherBundle.bundleName = WRONG_BUNDLE_NAME;
+    labelCache.Put(key, "first");
+    labelCache.Put(secondKey, "second");
+    labelCache.Put(otherBundle, "other");
+    std::string label;
+    EXPECT_FALSE(labelCache.Get(key, label));
+    EXPECT_EQ(labelCache.GetCount(), 2);
+    labelCache.Invalidate(BUNDLE_NAME);
+    EXPECT_FALSE(labelCache.Get(secondKey, label));
+    EXPECT_TRUE(labelCache.Get(otherBundle, label));
+    labelCache.Clear();
+    EXPECT_EQ(labelCache.GetCount(), 0);
+}
+
+/**
+ * @tc.number: RemoteAbilityInfoResult_0010
+ * @tc.name: Marshalling and Unmarshalling
+ * @tc.desc: Test a failed element keeps its elementName and result code through a parcel
+ */
+HWTEST_F(DbmsServicesKitTest, RemoteAbilityInfoResult_0010, Function | SmallTest | TestSize.Level0)
+{
+    RemoteAbilityInfoResult info;
+    info.remoteAbilityInfo.elementName.SetBundleName(BUNDLE_NAME);
+    info.remoteAbilityInfo.elementName.SetAbilityName(WRONG_ABILITY_NAME);
+    info.resultCode = ERR_BUNDLE_MANAGER_ABILITY_NOT_EXIST;
+    Parcel parcel;
+    EXPECT_TRUE(info.Marshalling(parcel));
+    std::unique_ptr<RemoteAbilityInfoResult> result(RemoteAbilityInfoResult::Unmarshalling(parcel));
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->remoteAbilityInfo.elementName.GetBundleName(), BUNDLE_NAME);
+    EXPECT_EQ(result->remoteAbilityInfo.elementName.GetAbilityName(), WRONG_ABILITY_NAME);
+    EXPECT_TRUE(result->remoteAbilityInfo.label.empty());
+    EXPECT_EQ(result->resultCode, ERR_BUNDLE_MANAGER_ABILITY_NOT_EXIST);
+}
+
+/**
+ * @tc.number: DbmsQuerySessions_0010
+ * @tc.name: Put and Take
+ * @tc.desc: Test a session only serves the caller which opened it and keeps its token between chunks
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsQuerySessions_0010, Function | SmallTest | TestSize.Level0)
+{
+    DbmsQuerySessions sessions(1, std::chrono::milliseconds(60 * 1000));
+    auto session = std::make_shared<DbmsQuerySession>();
+    session->callerTokenId = 1;
+    uint64_t token = sessions.Put(0, session);
+    EXPECT_NE(token, 0);
+    EXPECT_EQ(sessions.Take(token, 2), nullptr);
+    EXPECT_EQ(sessions.Take(token, 1), session);
+    EXPECT_EQ(sessions.Take(token, 1), nullptr);
+    EXPECT_EQ(sessions.Put(token, session), token);
+
+    auto otherSession = std::make_shared<DbmsQuerySession>();
+    uint64_t otherToken = sessions.Put(0, otherSession);
+    EXPECT_NE(otherToken, token);
+    EXPECT_EQ(sessions.GetCount(), 1);
+    EXPECT_EQ(sessions.Take(token, 1), nullptr);
+    sessions.Clear();
+    EXPECT_EQ(sessions.Take(otherToken, 0), nullptr);
+}
+
+/**
+ * @tc.number: DbmsQuerySessions_0020
+ * @tc.name: Take
+ * @tc.desc: Test an abandoned session expires
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsQuerySessions_0020, Function | SmallTest | TestSize.Level0)
+{
+    DbmsQuerySessions sessions(1, std::chrono::milliseconds(0));
+    auto session = std::make_shared<DbmsQuerySession>();
+    uint64_t token = sessions.Put(0, session);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_EQ(sessions.Take(token, 0), nullptr);
+    EXPECT_EQ(sessions.GetCount(), 0);
+}
+
+/**
+ * @tc.number: RemoteAbilityInfoOptions_0010
+ * @tc.name: Marshalling, Unmarshalling and IsValid
+ * @tc.desc: Test the options keep the fields and the icon edge through a parcel and reject no field
+ */
+HWTEST_F(DbmsServicesKitTest, RemoteAbilityInfoOptions_0010, Function | SmallTest | TestSize.Level0)
+{
+    RemoteAbilityInfoOptions options;
+    EXPECT_TRUE(options.HasLabel());
+    EXPECT_TRUE(options.HasIcon());
+    EXPECT_TRUE(options.IsValid());
+    options.fields = REMOTE_ABILITY_INFO_FIELD_ICON;
+    options.maxIconEdge = 48;
+    Parcel parcel;
+    EXPECT_TRUE(options.Marshalling(parcel));
+    std::unique_ptr<RemoteAbilityInfoOptions> result(RemoteAbilityInfoOptions::Unmarshalling(parcel));
+    ASSERT_NE(result, nullptr);
+    EXPECT_FALSE(result->HasLabel());
+    EXPECT_TRUE(result->HasIcon());
+    EXPECT_EQ(result->maxIconEdge, 48);
+    EXPECT_TRUE(result->IsValid());
+
+    options.fields = 0;
+    EXPECT_FALSE(options.IsValid());
+    options.fields = REMOTE_ABILITY_INFO_FIELD_ALL << 1;
+    EXPECT_FALSE(options.IsValid());
+    options.fields = REMOTE_ABILITY_INFO_FIELD_LABEL;
+    options.maxIconEdge = -1;
+    EXPECT_FALSE(options.IsValid());
+}
+
+/**
+ * @tc.number: GetAbilityInfosPartial_0010
+ * @tc.name: GetAbilityInfosPartial
+ * @tc.desc: Test invalid options fail the batch without querying any element
+ */
+HWTEST_F(DbmsServicesKitTest, GetAbilityInfosPartial_0010, Function | SmallTest | TestSize.Level0)
+{
+    auto distributedBms = GetDistributedBms();
+    ASSERT_NE(distributedBms, nullptr);
+    std::vector<ElementName> elementNames(1);
+    RemoteAbilityInfoOptions options;
+    options.fields = 0;
+    std::vector<RemoteAbilityInfoResult> results;
+    int32_t ret = distributedBms->GetAbilityInfosPartial(elementNames, "", options, results);
+    EXPECT_NE(ret, ERR_OK);
+    EXPECT_TRUE(results.empty());
+}
+
+/**
+ * @tc.number: DbmsAclCache_0010
+ * @tc.name: Get, Put and Invalidate
+ * @tc.desc: Test a decision is only served to the same caller of the same device and is dropped with the device
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsAclCache_0010, Function | SmallTest | TestSize.Level0)
+{
+    DbmsAclCache cache(2, std::chrono::milliseconds(60 * 1000));
+    DistributedBmsAclInfo info;
+    info.accountId = "account";
+    info.userId = 100;
+    info.tokenId = 1;
+    info.pkgName = "com.example.caller";
+    bool allowed = false;
+    EXPECT_FALSE(cache.Get("network1", info, allowed));
+    cache.Put("network1", info, true);
+    EXPECT_TRUE(cache.Get("network1", info, allowed));
+    EXPECT_TRUE(allowed);
+    EXPECT_FALSE(cache.Get("network2", info, allowed));
+    DistributedBmsAclInfo otherInfo = info;
+    otherInfo.userId = 101;
+    EXPECT_FALSE(cache.Get("network1", otherInfo, allowed));
+    cache.Put("network1", otherInfo, false);
+    EXPECT_TRUE(cache.Get("network1", otherInfo, allowed));
+    EXPECT_FALSE(allowed);
+    cache.Put("network10", info, true);
+    EXPECT_EQ(cache.GetCount(), 2);
+    cache.Invalidate("network1");
+    EXPECT_FALSE(cache.Get("network1", otherInfo, allowed));
+    EXPECT_TRUE(cache.Get("network10", info, allowed));
+    cache.Clear();
+    EXPECT_EQ(cache.GetCount(), 0);
+}
+
+/**
+ * @tc.number: DbmsAclCache_0020
+ * @tc.name: Get
+ * @tc.desc: Test a decision expires after the ttl
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsAclCache_0020, Function | SmallTest | TestSize.Level0)
+{
+    DbmsAclCache cache(1, std::chrono::milliseconds(0));
+    DistributedBmsAclInfo info;
+    cache.Put("network1", info, true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    bool allowed = false;
+    EXPECT_FALSE(cache.Get("network1", info, allowed));
+    EXPECT_EQ(cache.GetCount(), 0);
+}
+
+/**
+ * @tc.number: DbmsAclInfoCache_0010
+ * @tc.name: Get, Put and Invalidate
+ * @tc.desc: Test the acl info is kept per caller and active user and dropped with the bundle
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsAclInfoCache_0010, Function | SmallTest | TestSize.Level0)
+{
+    DbmsAclInfoCache cache(2);
+    DistributedBmsAclInfo info;
+    info.networkId = "network1";
+    info.userId = 100;
+    info.tokenId = 1;
+    info.pkgName = "com.example.caller";
+    DistributedBmsAclInfo result;
+    EXPECT_FALSE(cache.Get(20010001, 100, result));
+    cache.Put(20010001, 100, info);
+    EXPECT_TRUE(cache.Get(20010001, 100, result));
+    EXPECT_EQ(result.pkgName, info.pkgName);
+    EXPECT_EQ(result.tokenId, info.tokenId);
+    EXPECT_FALSE(cache.Get(20010001, 101, result));
+    EXPECT_FALSE(cache.Get(20010002, 100, result));
+    DistributedBmsAclInfo otherInfo = info;
+    otherInfo.pkgName = "com.example.other";
+    cache.Put(20010002, 100, otherInfo);
+    cache.Put(20010003, 100, otherInfo);
+    EXPECT_EQ(cache.GetCount(), 2);
+    cache.Invalidate("com.example.other");
+    EXPECT_EQ(cache.GetCount(), 0);
+    cache.Put(20010001, 100, info);
+    cache.Clear();
+    EXPECT_FALSE(cache.Get(20010001, 100, result));
+}
+
+/**
+ * @tc.number: GetLocalDevice_0210
+ * @tc.name: GetLocalDevice and OnDeviceInfoChanged
+ * @tc.desc: Test the local device info is kept after the first query and dropped when the local device changes
+ */
+HWTEST_F(DbmsServicesKitTest, GetLocalDevice_0210, Function | SmallTest | TestSize.Level0)
+{
+    DbmsDeviceManager deviceManager;
+    DistributedHardware::DmDeviceInfo dmDeviceInfo;
+    ASSERT_TRUE(deviceManager.GetLocalDevice(dmDeviceInfo));
+    auto localDevice = std::atomic_load(&DbmsDeviceManager::localDevice_);
+    ASSERT_NE(localDevice, nullptr);
+    DistributedHardware::DmDeviceInfo cachedInfo;
+    EXPECT_TRUE(deviceManager.GetLocalDevice(cachedInfo));
+    EXPECT_EQ(std::string(cachedInfo.networkId), std::string(dmDeviceInfo.networkId));
+    EXPECT_EQ(std::atomic_load(&DbmsDeviceManager::localDevice_), localDevice);
+
+    DistributedHardware::DmDeviceInfo remoteInfo = dmDeviceInfo;
+    remoteInfo.deviceId[0] = remoteInfo.deviceId[0] == 'x' ? 'y' : 'x';
+    remoteInfo.networkId[0] = remoteInfo.networkId[0] == 'x' ? 'y' : 'x';
+    DbmsDeviceManager::OnDeviceInfoChanged(remoteInfo);
+    EXPECT_NE(std::atomic_load(&DbmsDeviceManager::localDevice_), nullptr);
+    DbmsDeviceManager::OnDeviceInfoChanged(dmDeviceInfo);
+    EXPECT_EQ(std::atomic_load(&DbmsDeviceManager::localDevice_), nullptr);
+    EXPECT_TRUE(deviceManager.GetLocalDevice(cachedInfo));
+    DbmsDeviceManager::ResetLocalDevice();
+    EXPECT_EQ(std::atomic_load(&DbmsDeviceManager::localDevice_), nullptr);
+}
+
+/**
+ * @tc.number: AccountManagerHelper_0010
+ * @tc.name: SetCurrentActiveUserId and InitCurrentActiveUserId
+ * @tc.desc: Test a user switch received while the foreground user is queried is not overwritten by the query
+ */
+HWTEST_F(DbmsServicesKitTest, AccountManagerHelper_0010, Function | SmallTest | TestSize.Level0)
+{
+    int32_t userId = AccountManagerHelper::GetCurrentActiveUserId();
+    AccountManagerHelper::SetCurrentActiveUserId(Constants::INVALID_USERID);
+    EXPECT_EQ(AccountManagerHelper::InitCurrentActiveUserId(Constants::INVALID_USERID), Constants::INVALID_USERID);
+    EXPECT_EQ(AccountManagerHelper::InitCurrentActiveUserId(100), 100);
+    EXPECT_EQ(AccountManagerHelper::GetCurrentActiveUserId(), 100);
+
+    AccountManagerHelper::SetCurrentActiveUserId(Constants::INVALID_USERID);
+    // the switch to 101 lands between the query and the store of its stale result
+    AccountManagerHelper::SetCurrentActiveUserId(101);
+    EXPECT_EQ(AccountManagerHelper::InitCurrentActiveUserId(100), 101);
+    EXPECT_EQ(AccountManagerHelper::GetCurrentActiveUserId(), 101);
+    AccountManagerHelper::SetCurrentActiveUserId(userId);
+}
+
+/**
+ * @tc.number: AccountManagerHelper_0020
+ * @tc.name: GetCurrentActiveUserId
+ * @tc.desc: Test readers racing with user switches only see switched users and end with the last one
+ */
+HWTEST_F(DbmsServicesKitTest, AccountManagerHelper_0020, Function | SmallTest | TestSize.Level0)
+{
+    int32_t userId = AccountManagerHelper::GetCurrentActiveUserId();
+    constexpr int32_t firstUserId = 100;
+    constexpr int32_t switchCount = 1000;
+    constexpr int32_t readerCount = 4;
+    AccountManagerHelper::SetCurrentActiveUserId(firstUserId);
+    std::atomic<bool> unexpected = false;
+    std::atomic<bool> done = false;
+    std::vector<std::thread> readers;
+    for (int32_t i = 0; i < readerCount; ++i) {
+        readers.emplace_back([&unexpected, &done] {
+            while (!done) {
+                int32_t current = AccountManagerHelper::GetCurrentActiveUserId();
+                if (current < firstUserId || current >= firstUserId + switchCount) {
+                    unexpected = true;
+                }
+            }
+        });
+    }
+    for (int32_t i = 1; i < switchCount; ++i) {
+        AccountManagerHelper::SetCurrentActiveUserId(firstUserId + i);
+    }
+    done = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    EXPECT_FALSE(unexpected);
+    EXPECT_EQ(AccountManagerHelper::GetCurrentActiveUserId(), firstUserId + switchCount - 1);
+    AccountManagerHelper::SetCurrentActiveUserId(userId);
+}
+
+/**
+ * @tc.number: DbmsRemoteProxyCache_0010
+ * @tc.name: IsAlive, Remove and RemoveDead
+ * @tc.desc: Test a cached proxy is served without samgr and dropped when it dies or its device goes offline
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsRemoteProxyCache_0010, Function | SmallTest | TestSize.Level0)
+{
+    DbmsRemoteProxyCache cache;
+    EXPECT_EQ(cache.Get(""), nullptr);
+    EXPECT_FALSE(cache.IsAlive("device1"));
+    sptr<IDistributedBms> proxy = GetSptrDistributedBms();
+    ASSERT_NE(proxy, nullptr);
+    sptr<IRemoteObject::DeathRecipient> recipient = new (std::nothrow) DbmsRemoteProxyCache::RemoteDeathRecipient(
+        "device1");
+    cache.proxies_.emplace("device1", DbmsRemoteProxyCache::ProxyEntry { proxy, recipient });
+    EXPECT_TRUE(cache.IsAlive("device1"));
+    EXPECT_EQ(cache.Get("device1"), proxy);
+
+    sptr<IRemoteObject> otherObject = new (std::nothrow) DistributedBms();
+    cache.RemoveDead("device1", otherObject);
+    EXPECT_TRUE(cache.IsAlive("device1"));
+    cache.RemoveDead("device1", proxy->AsObject());
+    EXPECT_FALSE(cache.IsAlive("device1"));
+
+    cache.proxies_.emplace("device1", DbmsRemoteProxyCache::ProxyEntry { proxy, recipient });
+    cache.Remove("device1");
+    EXPECT_EQ(cache.GetCount(), 0);
+}
+
+/**
+ * @tc.number: QueryPartialChunk_0010
+ * @tc.name: QueryPartialChunk
+ * @tc.desc: Test the failure of a device is reported on its elements in input order when several devices are queried
+ */
+HWTEST_F(DbmsServicesKitTest, QueryPartialChunk_0010, Function | SmallTest | TestSize.Level0)
+{
+    auto distributedBms = GetDistributedBms();
+    ASSERT_NE(distributedBms, nullptr);
+    DbmsQuerySession session;
+    session.elementNames.emplace_back("unknownDevice1", "com.example.a", "MainAbility", "entry");
+    session.elementNames.emplace_back("unknownDevice2", "com.example.b", "MainAbility", "entry");
+    session.elementNames.emplace_back("unknownDevice1", "", "MainAbility", "entry");
+    session.elementNames.emplace_back("unknownDevice1", "com.example.c", "MainAbility", "entry");
+    std::vector<RemoteAbilityInfoResult> results;
+    int32_t ret = distributedBms->QueryPartialChunk(session, session.elementNames.size(), results);
+    EXPECT_EQ(ret, ERR_OK);
+    ASSERT_EQ(results.size(), session.elementNames.size());
+    EXPECT_EQ(results[0].resultCode, ERR_BUNDLE_MANAGER_DEVICE_ID_NOT_EXIST);
+    EXPECT_EQ(results[1].resultCode, ERR_BUNDLE_MANAGER_DEVICE_ID_NOT_EXIST);
+    EXPECT_EQ(results[2].resultCode, ERR_BUNDLE_MANAGER_BUNDLE_NOT_EXIST);
+    EXPECT_EQ(results[3].resultCode, ERR_BUNDLE_MANAGER_DEVICE_ID_NOT_EXIST);
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i].remoteAbilityInfo.elementName.GetBundleName(), session.elementNames[i].GetBundleName());
+    }
+
+    DbmsQuerySession singleDeviceSession;
+    singleDeviceSession.elementNames.emplace_back("unknownDevice1", "com.example.a", "MainAbility", "entry");
+    results.clear();
+    ret = distributedBms->QueryPartialChunk(singleDeviceSession, 1, results);
+    EXPECT_EQ(ret, ERR_BUNDLE_MANAGER_DEVICE_ID_NOT_EXIST);
+    EXPECT_TRUE(results.empty());
+}
+
+/**
+ * @tc.number: DbmsTaskPool_0020
+ * @tc.name: Post
+ * @tc.desc: Test posted tasks run on the workers, and may fan out again
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsTaskPool_0020, Function | SmallTest | TestSize.Level0)
+{
+    DbmsTaskPool taskPool(2);
+    constexpr int32_t taskCount = 8;
+    constexpr size_t fanOut = 3;
+    std::atomic<int32_t> runCount(0);
+    std::vector<std::promise<void>> finished(taskCount);
+    for (int32_t i = 0; i < taskCount; ++i) {
+        taskPool.Post([&taskPool, &runCount, &finished, i] {
+            taskPool.ParallelFor(fanOut, [&runCount](size_t) {
+                runCount++;
+            });
+            finished[i].set_value();
+        });
+    }
+    for (auto &item : finished) {
+        EXPECT_EQ(item.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    }
+    EXPECT_EQ(runCount.load(), taskCount * static_cast<int32_t>(fanOut));
+}
+
+/**
+ * @tc.number: GetRemoteBundleVersionCodeAsync_0010
+ * @tc.name: test GetRemoteBundleVersionCodeAsync
+ * @tc.desc: Test a rejected query is answered through the callback exactly once
+ */
+HWTEST_F(DbmsServicesKitTest, GetRemoteBundleVersionCodeAsync_0010, Function | SmallTest | TestSize.Level0)
+{
+    class VersionCodeCallback : public DistributedBmsCallbackStub {
+    public:
+        void OnRemoteAbilityInfosResult(int32_t resultCode,
+            const std::vector<RemoteAbilityInfo> &remoteAbilityInfos) override {}
+        void OnRemoteBundleVersionCodeResult(int32_t resultCode, uint32_t versionCode) override
+        {
+            resultCount++;
+            lastResultCode = resultCode;
+        }
+        void OnDistributedBundleInfoResult(bool result, const DistributedBundleInfo &distributedBundleInfo) override {}
+
+        int32_t resultCount = 0;
+        int32_t lastResultCode = ERR_OK;
+    };
+    auto distributedBms = GetDistributedBms();
+    ASSERT_NE(distributedBms, nullptr);
+    EXPECT_EQ(distributedBms->GetRemoteBundleVersionCodeAsync("", BUNDLE_NAME, nullptr),
+        ERR_APPEXECFWK_PARCEL_ERROR);
+    sptr<VersionCodeCallback> callback = new (std::nothrow) VersionCodeCallback();
+    ASSERT_NE(callback, nullptr);
+    int32_t ret = distributedBms->GetRemoteBundleVersionCodeAsync("", BUNDLE_NAME, callback->AsObject());
+    EXPECT_NE(ret, ERR_OK);
+    EXPECT_EQ(callback->resultCount, 1);
+    EXPECT_EQ(callback->lastResultCode, ret);
+}
+
+/**
+ * @tc.number: DbmsSingleFlight_0010
+ * @tc.name: Do
+ * @tc.desc: Test concurrent callers of the same key share one query, and a finished query is not shared
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsSingleFlight_0010, Function | SmallTest | TestSize.Level0)
+{
+    DbmsSingleFlight<std::vector<int32_t>> flight;
+    constexpr int32_t callerNum = 4;
+    constexpr int32_t resultCode = 1;
+    std::atomic<int32_t> runCount(0);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::vector<int32_t> resultCodes(callerNum, ERR_OK);
+    std::vector<std::vector<int32_t>> results(callerNum);
+    std::vector<std::thread> callers;
+    for (int32_t i = 0; i < callerNum; ++i) {
+        callers.emplace_back([&flight, &runCount, &released, &resultCodes, &results, i] {
+            resultCodes[i] = flight.Do("key", [&runCount, &released](std::vector<int32_t> &result) {
+                runCount++;
+                released.wait();
+                result = { 1, 2 };
+                return resultCode;
+            }, results[i]);
+        });
+    }
+    // the first caller holds its query until every other caller waits on it
+    auto getWaiterNum = [&flight] {
+        std::lock_guard<std::mutex> lock(flight.mutex_);
+        auto item = flight.calls_.find("key");
+        return item == flight.calls_.end() ? static_cast<size_t>(0) : item->second->waiterNum;
+    };
+    while (getWaiterNum() < static_cast<size_t>(callerNum - 1)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(flight.GetCount(), 1);
+    release.set_value();
+    for (auto &caller : callers) {
+        caller.join();
+    }
+    EXPECT_EQ(runCount.load(), 1);
+    for (int32_t i = 0; i < callerNum; ++i) {
+        EXPECT_EQ(resultCodes[i], resultCode);
+        EXPECT_EQ(results[i], std::vector<int32_t>({ 1, 2 }));
+    }
+    EXPECT_EQ(flight.GetCount(), 0);
+
+    std::vector<int32_t> result;
+    EXPECT_EQ(flight.Do("key", [&runCount](std::vector<int32_t> &) {
+        runCount++;
+        return ERR_OK;
+    }, result), ERR_OK);
+    EXPECT_EQ(runCount.load(), 2);
+}
+
+/**
+ * @tc.number: DistributedBmsDeadline_0010
+ * @tc.name: DistributedBmsDeadline
+ * @tc.desc: Test a nested deadline only shortens the outer one and is restored on scope exit
+ */
+HWTEST_F(DbmsServicesKitTest, DistributedBmsDeadline_0010, Function | SmallTest | TestSize.Level0)
+{
+    EXPECT_EQ(DistributedBmsDeadline::GetRemainingMs(), DistributedBmsDeadline::NO_DEADLINE);
+    EXPECT_FALSE(DistributedBmsDeadline::IsExpired());
+    {
+        DistributedBmsDeadline outer(60000);
+        EXPECT_GT(DistributedBmsDeadline::GetRemainingMs(), 0);
+        EXPECT_LE(DistributedBmsDeadline::GetRemainingMs(), 60000);
+        {
+            DistributedBmsDeadline longer(120000);
+            EXPECT_LE(DistributedBmsDeadline::GetRemainingMs(), 60000);
+            DistributedBmsDeadline none(DistributedBmsDeadline::NO_DEADLINE);
+            EXPECT_LE(DistributedBmsDeadline::GetRemainingMs(), 60000);
+        }
+        {
+            DistributedBmsDeadline expired(0);
+            EXPECT_TRUE(DistributedBmsDeadline::IsExpired());
+            EXPECT_EQ(DistributedBmsDeadline::GetRemainingMs(), 0);
+        }
+        EXPECT_FALSE(DistributedBmsDeadline::IsExpired());
+    }
+    EXPECT_EQ(DistributedBmsDeadline::GetRemainingMs(), DistributedBmsDeadline::NO_DEADLINE);
+}
+
+/**
+ * @tc.number: DistributedBmsDeadline_0020
+ * @tc.name: ReadFromParcel
+ * @tc.desc: Test the remaining time is read from the end of a request, and none from a request without it
+ */
+HWTEST_F(DbmsServicesKitTest, DistributedBmsDeadline_0020, Function | SmallTest | TestSize.Level0)
+{
+    MessageParcel data;
+    EXPECT_EQ(DistributedBmsDeadline::ReadFromParcel(data), DistributedBmsDeadline::NO_DEADLINE);
+    EXPECT_TRUE(data.WriteInt64(1500));
+    EXPECT_EQ(DistributedBmsDeadline::ReadFromParcel(data), 1500);
+    EXPECT_TRUE(data.WriteInt64(-1));
+    EXPECT_EQ(DistributedBmsDeadline::ReadFromParcel(data), DistributedBmsDeadline::NO_DEADLINE);
+}
+
+/**
+ * @tc.number: DbmsTaskPool_0030
+ * @tc.name: ParallelFor
+ * @tc.desc: Test the helpers keep to the deadline of the calling thread
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsTaskPool_0030, Function | SmallTest | TestSize.Level0)
+{
+    DbmsTaskPool taskPool(3);
+    constexpr size_t taskCount = 8;
+    std::atomic<int32_t> expiredCount(0);
+    {
+        DistributedBmsDeadline deadline(0);
+        taskPool.ParallelFor(taskCount, [&expiredCount](size_t) {
+            if (DistributedBmsDeadline::IsExpired()) {
+                expiredCount++;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        });
+    }
+    EXPECT_EQ(expiredCount.load(), static_cast<int32_t>(taskCount));
+    expiredCount = 0;
+    taskPool.ParallelFor(taskCount, [&expiredCount](size_t) {
+        if (DistributedBmsDeadline::GetRemainingMs() != DistributedBmsDeadline::NO_DEADLINE) {
+            expiredCount++;
+        }
+    });
+    EXPECT_EQ(expiredCount.load(), 0);
+}
+
+/**
+ * @tc.number: DbmsSingleFlight_0020
+ * @tc.name: Do
+ * @tc.desc: Test a waiter gives up at its own deadline while the query in flight goes on
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsSingleFlight_0020, Function | SmallTest | TestSize.Level0)
+{
+    DbmsSingleFlight<int32_t> flight;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void> started;
+    int32_t ownerResult = 0;
+    int32_t ownerResultCode = ERR_APPEXECFWK_SERVICE_INTERNAL_ERROR;
+    std::thread owner([&flight, &released, &started, &ownerResult, &ownerResultCode] {
+        ownerResultCode = flight.Do("key", [&released, &started](int32_t &result) {
+            started.set_value();
+            released.wait();
+            result = 1;
+            return ERR_OK;
+        }, ownerResult);
+    });
+    started.get_future().wait();
+    {
+        DistributedBmsDeadline deadline(10);
+        int32_t result = 0;
+        EXPECT_EQ(flight.Do("key", [](int32_t &) { return ERR_OK; }, result), ERR_DBMS_DEADLINE_EXCEEDED);
+    }
+    release.set_value();
+    owner.join();
+    EXPECT_EQ(ownerResultCode, ERR_OK);
+    EXPECT_EQ(ownerResult, 1);
+}
+
+/**
+ * @tc.number: BatchGetAbilityLabelAndIcon_0020
+ * @tc.name: ResolveAbilityInfos
+ * @tc.desc: Test a batch whose deadline has passed is abandoned before any bms lookup
+ */
+HWTEST_F(DbmsServicesKitTest, BatchGetAbilityLabelAndIcon_0020, Function | SmallTest | TestSize.Level0)
+{
+    auto distributedBms = GetDistributedBms();
+    ASSERT_NE(distributedBms, nullptr);
+    std::vector<ElementName> elementNames(2);
+    elementNames[0].SetBundleName(BUNDLE_NAME);
+    elementNames[0].SetAbilityName(ABILITY_NAME);
+    elementNames[1] = elementNames[0];
+    DistributedBmsDeadline deadline(0);
+    std::vector<AbilityLabelAndIcon> results;
+    distributedBms->BatchGetAbilityLabelAndIcon(elementNames, "", results);
+    ASSERT_EQ(results.size(), elementNames.size());
+    for (const auto &result : results) {
+        EXPECT_EQ(result.result, ERR_DBMS_DEADLINE_EXCEEDED);
+    }
+    std::vector<RemoteAbilityInfo> remoteAbilityInfos;
+    EXPECT_EQ(distributedBms->ResolveAbilityInfos(elementNames, "", remoteAbilityInfos), ERR_DBMS_DEADLINE_EXCEEDED);
+    EXPECT_TRUE(remoteAbilityInfos.empty());
+}
+
+/**
+ * @tc.number: DbmsBundleNameIndex_0010
+ * @tc.name: Get
+ * @tc.desc: Test the bundle name of an access token id follows the changes of the bundle
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsBundleNameIndex_0010, Function | SmallTest | TestSize.Level0)
+{
+    DbmsBundleNameIndex bundleNameIndex;
+    std::string bundleName;
+    bundleNameIndex.Put(DEVICE_ID, BUNDLE_NAME, 1);
+    EXPECT_TRUE(bundleNameIndex.Get(DEVICE_ID, 1, bundleName));
+    EXPECT_EQ(bundleName, BUNDLE_NAME);
+    EXPECT_FALSE(bundleNameIndex.IsLoaded(DEVICE_ID));
+
+    bundleNameIndex.Put(DEVICE_ID, BUNDLE_NAME, 2);
+    EXPECT_FALSE(bundleNameIndex.Get(DEVICE_ID, 1, bundleName));
+    EXPECT_TRUE(bundleNameIndex.Get(DEVICE_ID, 2, bundleName));
+    bundleNameIndex.Remove(DEVICE_ID, BUNDLE_NAME);
+    EXPECT_FALSE(bundleNameIndex.Get(DEVICE_ID, 2, bundleName));
+
+    EXPECT_FALSE(bundleNameIndex.Load(DEVICE_ID, [](DbmsBundleNameIndex::Rows &rows) { return false; }));
+    EXPECT_FALSE(bundleNameIndex.IsLoaded(DEVICE_ID));
+    EXPECT_TRUE(bundleNameIndex.Load(DEVICE_ID, [](DbmsBundleNameIndex::Rows &rows) {
+        rows.emplace_back(BUNDLE_NAME, 3);
+        return true;
+    }));
+    EXPECT_TRUE(bundleNameIndex.IsLoaded(DEVICE_ID));
+    EXPECT_TRUE(bundleNameIndex.Get(DEVICE_ID, 3, bundleName));
+    bundleNameIndex.Invalidate(DEVICE_ID);
+    EXPECT_FALSE(bundleNameIndex.IsLoaded(DEVICE_ID));
+    EXPECT_FALSE(bundleNameIndex.Get(DEVICE_ID, 3, bundleName));
+}
+
+/**
+ * @tc.number: DbmsBundleNameIndex_0020
+ * @tc.name: OnChange
+ * @tc.desc: Test the store change notifications update the bundle name index
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsBundleNameIndex_0020, Function | SmallTest | TestSize.Level0)
+{
+    auto bundleNameIndex = DbmsBundleNameIndex::GetInstance();
+    ASSERT_NE(bundleNameIndex, nullptr);
+    bundleNameIndex->Clear();
+    DistributedBundleInfo distributedBundleInfo;
+    distributedBundleInfo.bundleName = BUNDLE_NAME;
+    distributedBundleInfo.accessTokenId = 1;
+    DistributedKv::Entry entry;
+    entry.key = DistributedKv::Key(DEVICE_ID + "_" + BUNDLE_NAME);
+    entry.value = DistributedKv::Value(distributedBundleInfo.ToString());
+    DistributedKv::Entry invalidEntry;
+    invalidEntry.key = DistributedKv::Key(BUNDLE_NAME);
+    invalidEntry.value = entry.value;
+    DistributedDataStorageObserver observer;
+    observer.OnChange(DistributedKv::ChangeNotification({ entry, invalidEntry }, {}, {}, DEVICE_ID, false));
+    std::string bundleName;
+    EXPECT_TRUE(bundleNameIndex->Get(DEVICE_ID, 1, bundleName));
+    EXPECT_EQ(bundleName, BUNDLE_NAME);
+
+    observer.OnChange(DistributedKv::ChangeNotification({}, {}, { entry }, DEVICE_ID, false));
+    EXPECT_FALSE(bundleNameIndex->Get(DEVICE_ID, 1, bundleName));
+}
+
+/**
+ * @tc.number: DbmsBundleNameIndex_0030
+ * @tc.name: InvalidateByNetworkId
+ * @tc.desc: Test the bundles of a device are dropped when the device goes offline
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsBundleNameIndex_0030, Function | SmallTest | TestSize.Level0)
+{
+    auto bundleNameIndex = DbmsBundleNameIndex::GetInstance();
+    ASSERT_NE(bundleNameIndex, nullptr);
+    bundleNameIndex->Clear();
+    const std::string networkId = "networkId";
+    bundleNameIndex->Put(DEVICE_ID, BUNDLE_NAME, 1);
+    bundleNameIndex->BindNetworkId(networkId, DEVICE_ID);
+    std::string bundleName;
+    EXPECT_TRUE(bundleNameIndex->Get(DEVICE_ID, 1, bundleName));
+
+    bundleNameIndex->InvalidateByNetworkId(WRONG_BUNDLE_NAME);
+    EXPECT_TRUE(bundleNameIndex->Get(DEVICE_ID, 1, bundleName));
+    std::shared_ptr<DistributedHardware::DeviceStateCallback> deviceStateCallBack =
+        std::make_shared<DbmsDeviceManager::DeviceStateCallBack>();
+    DistributedHardware::DmDeviceInfo deviceInfo {};
+    networkId.copy(deviceInfo.networkId, networkId.size());
+    deviceStateCallBack->OnDeviceOffline(deviceInfo);
+    EXPECT_FALSE(bundleNameIndex->Get(DEVICE_ID, 1, bundleName));
+    EXPECT_FALSE(bundleNameIndex->IsLoaded(DEVICE_ID));
+}
+
+/**
+ * @tc.number: DbmsBundleNameIndex_0040
+ * @tc.name: LoadBundleNameIndex
+ * @tc.desc: Test only the rows of the device are loaded, not those of udids sharing its digits
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsBundleNameIndex_0040, Function | SmallTest | TestSize.Level0)
+{
+    auto distributedDataStorage = GetDistributedDataStorage();
+    ASSERT_NE(distributedDataStorage, nullptr);
+    ASSERT_TRUE(distributedDataStorage->CheckKvStore());
+    auto bundleNameIndex = DbmsBundleNameIndex::GetInstance();
+    ASSERT_NE(bundleNameIndex, nullptr);
+    bundleNameIndex->Clear();
+    const std::vector<std::string> udids = { DEVICE_ID, DEVICE_ID + "2", "2" + DEVICE_ID };
+    for (size_t i = 0; i < udids.size(); ++i) {
+        DistributedBundleInfo distributedBundleInfo;
+        distributedBundleInfo.bundleName = BUNDLE_NAME;
+        distributedBundleInfo.accessTokenId = static_cast<uint32_t>(i + 1);
+        DistributedKv::Key key(distributedDataStorage->DeviceAndNameToKey(udids[i], BUNDLE_NAME));
+        DistributedKv::Value value(distributedBundleInfo.ToString());
+        ASSERT_EQ(distributedDataStorage->kvStorePtr_->Put(key, value), DistributedKv::Status::SUCCESS);
+    }
+    EXPECT_TRUE(distributedDataStorage->LoadBundleNameIndex(DEVICE_ID));
+    std::string bundleName;
+    EXPECT_TRUE(bundleNameIndex->Get(DEVICE_ID, 1, bundleName));
+    EXPECT_EQ(bundleName, BUNDLE_NAME);
+    EXPECT_FALSE(bundleNameIndex->Get(DEVICE_ID, 2, bundleName));
+    EXPECT_FALSE(bundleNameIndex->Get(DEVICE_ID, 3, bundleName));
+    EXPECT_FALSE(bundleNameIndex->IsLoaded(udids[1]));
+    for (const auto &udid : udids) {
+        distributedDataStorage->kvStorePtr_->Delete(
+            DistributedKv::Key(distributedDataStorage->DeviceAndNameToKey(udid, BUNDLE_NAME)));
+    }
+    bundleNameIndex->Clear();
+}
+
+/**
+ * @tc.number: DbmsBundleNameIndex_0050
+ * @tc.name: InnerSaveStorageDistributeInfo and DeleteStorageDistributeInfo
+ * @tc.desc: Test the local writes update a loaded index, which gets no change notification of them
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsBundleNameIndex_0050, Function | SmallTest | TestSize.Level0)
+{
+    auto distributedDataStorage = GetDistributedDataStorage();
+    ASSERT_NE(distributedDataStorage, nullptr);
+    ASSERT_TRUE(distributedDataStorage->CheckKvStore());
+    std::string udid;
+    ASSERT_TRUE(distributedDataStorage->GetLocalUdid(udid));
+    auto bundleNameIndex = DbmsBundleNameIndex::GetInstance();
+    ASSERT_NE(bundleNameIndex, nullptr);
+    bundleNameIndex->Clear();
+    ASSERT_TRUE(distributedDataStorage->LoadBundleNameIndex(udid));
+    DistributedBundleInfo distributedBundleInfo;
+    distributedBundleInfo.bundleName = BUNDLE_NAME;
+    distributedBundleInfo.accessTokenId = 1;
+    ASSERT_TRUE(distributedDataStorage->InnerSaveStorageDistributeInfo(distributedBundleInfo));
+    std::string bundleName;
+    EXPECT_TRUE(bundleNameIndex->Get(udid, 1, bundleName));
+    EXPECT_EQ(bundleName, BUNDLE_NAME);
+
+    // a reinstalled bundle gets a new access token id
+    distributedBundleInfo.accessTokenId = 2;
+    ASSERT_TRUE(distributedDataStorage->InnerSaveStorageDistributeInfo(distributedBundleInfo));
+    EXPECT_FALSE(bundleNameIndex->Get(udid, 1, bundleName));
+    EXPECT_TRUE(bundleNameIndex->Get(udid, 2, bundleName));
+
+    distributedDataStorage->DeleteStorageDistributeInfo(BUNDLE_NAME, AccountManagerHelper::GetCurrentActiveUserId());
+    EXPECT_FALSE(bundleNameIndex->Get(udid, 2, bundleName));
+    EXPECT_TRUE(bundleNameIndex->IsLoaded(udid));
+    bundleNameIndex->Clear();
+}
+
+/**
+ * @tc.number: DistributedBundleInfoCodec_0010
+ * @tc.name: Encode
+ * @tc.desc: Test a compact record decodes to the same bundle info and is smaller than the json
+ */
+HWTEST_F(DbmsServicesKitTest, DistributedBundleInfoCodec_0010, Function | SmallTest | TestSize.Level0)
+{
+    DistributedBundleInfo distributedBundleInfo;
+    distributedBundleInfo.version = 2;
+    distributedBundleInfo.bundleName = BUNDLE_NAME;
+    distributedBundleInfo.versionName = "1.0.0";
+    distributedBundleInfo.versionCode = 1000000;
+    distributedBundleInfo.accessTokenId = 1;
+    distributedBundleInfo.updateTime = 1;
+    distributedBundleInfo.enabled = false;
+    DistributedModuleInfo distributedModuleInfo;
+    distributedModuleInfo.moduleName = MODULE_NAME;
+    DistributedAbilityInfo distributedAbilityInfo;
+    distributedAbilityInfo.abilityName = ABILITY_NAME;
+    distributedAbilityInfo.permissions = { "ohos.permission.INTERNET", "ohos.permission.DISTRIBUTED_DATASYNC" };
+    distributedAbilityInfo.type = AbilityType::PAGE;
+    distributedModuleInfo.abilities = { distributedAbilityInfo, distributedAbilityInfo };
+    distributedBundleInfo.moduleInfos.emplace_back(distributedModuleInfo);
+
+    std::vector<uint8_t> value = DistributedBundleInfoCodec::Encode(distributedBundleInfo);
+    ASSERT_FALSE(value.empty());
+    EXPECT_EQ(value[0], DistributedBundleInfoCodec::SCHEMA_VERSION);
+    EXPECT_LT(value.size(), distributedBundleInfo.ToString().size());
+    DistributedBundleInfo decodedInfo;
+    ASSERT_TRUE(DistributedBundleInfoCodec::Decode(value, decodedInfo));
+    EXPECT_EQ(decodedInfo.version, distributedBundleInfo.version);
+    EXPECT_EQ(decodedInfo.ToString(), distributedBundleInfo.ToString());
+
+    value.pop_back();
+    EXPECT_FALSE(DistributedBundleInfoCodec::Decode(value, decodedInfo));
+    EXPECT_FALSE(DistributedBundleInfoCodec::Decode({}, decodedInfo));
+}
+
+/**
+ * @tc.number: DistributedBundleInfoCodec_0020
+ * @tc.name: Decode
+ * @tc.desc: Test the json of a device without the codec is still decoded
+ */
+HWTEST_F(DbmsServicesKitTest, DistributedBundleInfoCodec_0020, Function | SmallTest | TestSize.Level0)
+{
+    DistributedBundleInfo distributedBundleInfo;
+    distributedBundleInfo.bundleName = BUNDLE_NAME;
+    distributedBundleInfo.accessTokenId = 1;
+    std::string json = distributedBundleInfo.ToString();
+    DistributedBundleInfo decodedInfo;
+    EXPECT_TRUE(DistributedBundleInfoCodec::Decode(std::vector<uint8_t>(json.begin(), json.end()), decodedInfo));
+    EXPECT_EQ(decodedInfo.bundleName, BUNDLE_NAME);
+    EXPECT_EQ(decodedInfo.accessTokenId, 1U);
+}
+
+/**
+ * @tc.number: DistributedBundleInfoCodec_0030
+ * @tc.name: InnerSaveStorageDistributeInfo
+ * @tc.desc: Test the json is stored unless the product enables the compact record
+ */
+HWTEST_F(DbmsServicesKitTest, DistributedBundleInfoCodec_0030, Function | SmallTest | TestSize.Level0)
+{
+    auto distributedDataStorage = GetDistributedDataStorage();
+    ASSERT_NE(distributedDataStorage, nullptr);
+    ASSERT_TRUE(distributedDataStorage->CheckKvStore());
+    std::string udid;
+    ASSERT_TRUE(distributedDataStorage->GetLocalUdid(udid));
+    DistributedBundleInfo distributedBundleInfo;
+    distributedBundleInfo.bundleName = BUNDLE_NAME;
+    distributedBundleInfo.accessTokenId = 1;
+    ASSERT_TRUE(distributedDataStorage->InnerSaveStorageDistributeInfo(distributedBundleInfo));
+
+    DistributedKv::Key key(distributedDataStorage->DeviceAndNameToKey(udid, BUNDLE_NAME));
+    DistributedKv::Value value;
+    ASSERT_EQ(distributedDataStorage->kvStorePtr_->Get(key, value), DistributedKv::Status::SUCCESS);
+    if (DistributedDataStorage::IsCompactRecordEnabled()) {
+        EXPECT_EQ(value.Data(), DistributedBundleInfoCodec::Encode(distributedBundleInfo));
+    } else {
+        EXPECT_EQ(value.ToString(), distributedBundleInfo.ToString());
+    }
+    distributedDataStorage->kvStorePtr_->Delete(key);
+}
+
+/**
+ * @tc.number: DbmsTaskPool_0040
+ * @tc.name: Post
+ * @tc.desc: Test a task is rejected while the posted tasks waiting for a worker reach the limit
+ */
+HWTEST_F(DbmsServicesKitTest, DbmsTaskPool_0040, Function | SmallTest | TestSize.Level0)
+{
+    DbmsTaskPool taskPool(1, 1);
+    std::promise<void> started;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void> finished;
+    EXPECT_TRUE(taskPool.Post([&started, released] {
+        started.set_value();
+        released.wait();
+    }));
+    ASSERT_EQ(started.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_TRUE(taskPool.Post([&finished] { finished.set_value(); }));
+    EXPECT_FALSE(taskPool.Post([] {}));
+    release.set_value();
+    EXPECT_EQ(finished.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_TRUE(DbmsTaskPool::GetAsyncInstance() != DbmsTaskPool::GetInstance());
+}
+} // OHOS
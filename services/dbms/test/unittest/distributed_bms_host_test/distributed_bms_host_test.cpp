@@ -18,6 +18,7 @@
 #include "distributed_bms_host.h"
 
 #include "appexecfwk_errors.h"
+#include "distributed_bms_callback_stub.h"
 #include "distributed_bms_proxy.h"
 #include "distributed_bundle_ipc_interface_code.h"
 #undef private
@@ -27,6 +28,30 @@ using namespace testing::ext;
 using namespace OHOS::AppExecFwk;
 
 namespace OHOS {
+namespace {
+class TestDistributedBmsCallback : public DistributedBmsCallbackStub {
+public:
+    void OnRemoteAbilityInfosResult(int32_t resultCode,
+        const std::vector<RemoteAbilityInfo> &remoteAbilityInfos) override
+    {
+        resultCount++;
+        lastResultCode = resultCode;
+    }
+    void OnRemoteBundleVersionCodeResult(int32_t resultCode, uint32_t versionCode) override
+    {
+        resultCount++;
+        lastResultCode = resultCode;
+    }
+    void OnDistributedBundleInfoResult(bool result, const DistributedBundleInfo &distributedBundleInfo) override
+    {
+        resultCount++;
+    }
+
+    int32_t resultCount = 0;
+    int32_t lastResultCode = ERR_OK;
+};
+}
+
 class DistributedBmsHostTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -880,4 +905,287 @@ HWTEST_F(DistributedBmsHostTest, OnRemoteRequest_1400, Function | MediumTest | T
         (DistributedInterfaceCode::GET_BUNDLE_VERSION_CODE), data, reply, option);
     EXPECT_EQ(res, NO_ERROR);
 }
-}
\ No newline at end of file
+
+/**
+ * @tc.number: OnRemoteRequest_1500
+ * @tc.name: Test OnRemoteRequest with GET_REMOTE_ABILITY_INFOS_WITH_BINARY_ICON
+ * @tc.desc: Verify the OnRemoteRequest return NO_ERROR.
+ */
+HWTEST_F(DistributedBmsHostTest, OnRemoteRequest_1500, Function | MediumTest | TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    data.WriteInterfaceToken(DistributedBmsHost::GetDescriptor());
+    std::vector<ElementName> elementNames;
+    std::string localeInfo;
+    DistributedBmsProxy proxy(nullptr);
+    proxy.WriteParcelableVector(elementNames, data);
+    data.WriteString(localeInfo);
+
+    MockDistributedBmsHost host;
+    int res = host.OnRemoteRequest(static_cast<uint32_t>
+        (DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_WITH_BINARY_ICON), data, reply, option);
+    EXPECT_EQ(res, NO_ERROR);
+    EXPECT_TRUE(reply.ReadBool());
+    EXPECT_EQ(reply.ReadInt32(), 0);
+}
+
+/**
+ * @tc.number: OnRemoteRequest_1600
+ * @tc.name: Test OnRemoteRequest with GET_ABILITY_INFOS_WITH_BINARY_ICON
+ * @tc.desc: Verify the OnRemoteRequest return NO_ERROR.
+ */
+HWTEST_F(DistributedBmsHostTest, OnRemoteRequest_1600, Function | MediumTest | TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    data.WriteInterfaceToken(DistributedBmsHost::GetDescriptor());
+    std::vector<ElementName> elementNames;
+    std::string localeInfo;
+    DistributedBmsProxy proxy(nullptr);
+    proxy.WriteParcelableVector(elementNames, data);
+    data.WriteString(localeInfo);
+    DistributedBmsAclInfo aclInfo;
+    aclInfo.networkId = "networkId";
+    data.WriteBool(true);
+    data.WriteParcelable(&aclInfo);
+
+    MockDistributedBmsHost host;
+    int res = host.OnRemoteRequest(static_cast<uint32_t>
+        (DistributedInterfaceCode::GET_ABILITY_INFOS_WITH_BINARY_ICON), data, reply, option);
+    EXPECT_EQ(res, NO_ERROR);
+}
+
+/**
+ * @tc.number: OnRemoteRequest_1700
+ * @tc.name: Test OnRemoteRequest with GET_REMOTE_ABILITY_INFOS_IF_MODIFIED
+ * @tc.desc: Verify the OnRemoteRequest return NO_ERROR.
+ */
+HWTEST_F(DistributedBmsHostTest, OnRemoteRequest_1700, Function | MediumTest | TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    data.WriteInterfaceToken(DistributedBmsHost::GetDescriptor());
+    std::vector<ElementName> elementNames;
+    std::vector<std::string> iconHashes;
+    std::string localeInfo;
+    DistributedBmsProxy proxy(nullptr);
+    proxy.WriteParcelableVector(elementNames, data);
+    data.WriteStringVector(iconHashes);
+    data.WriteString(localeInfo);
+
+    MockDistributedBmsHost host;
+    int res = host.OnRemoteRequest(static_cast<uint32_t>
+        (DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_IF_MODIFIED), data, reply, option);
+    EXPECT_EQ(res, NO_ERROR);
+}
+
+/**
+ * @tc.number: OnRemoteRequest_1800
+ * @tc.name: Test OnRemoteRequest with GET_ABILITY_INFOS_IF_MODIFIED
+ * @tc.desc: Verify the OnRemoteRequest return ERR_APPEXECFWK_PARCEL_ERROR when the hashes do not match elements.
+ */
+HWTEST_F(DistributedBmsHostTest, OnRemoteRequest_1800, Function | MediumTest | TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    data.WriteInterfaceToken(DistributedBmsHost::GetDescriptor());
+    std::vector<ElementName> elementNames;
+    std::vector<std::string> iconHashes = { "hash" };
+    std::string localeInfo;
+    DistributedBmsProxy proxy(nullptr);
+    proxy.WriteParcelableVector(elementNames, data);
+    data.WriteStringVector(iconHashes);
+    data.WriteString(localeInfo);
+    data.WriteBool(false);
+
+    MockDistributedBmsHost host;
+    int res = host.OnRemoteRequest(static_cast<uint32_t>
+        (DistributedInterfaceCode::GET_ABILITY_INFOS_IF_MODIFIED), data, reply, option);
+    EXPECT_EQ(res, ERR_APPEXECFWK_PARCEL_ERROR);
+}
+
+/**
+ * @tc.number: OnRemoteRequest_1900
+ * @tc.name: Test OnRemoteRequest with GET_REMOTE_ABILITY_INFOS_PARTIAL
+ * @tc.desc: Verify the OnRemoteRequest return NO_ERROR.
+ */
+HWTEST_F(DistributedBmsHostTest, OnRemoteRequest_1900, Function | MediumTest | TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    data.WriteInterfaceToken(DistributedBmsHost::GetDescriptor());
+    std::vector<ElementName> elementNames;
+    std::string localeInfo;
+    DistributedBmsProxy proxy(nullptr);
+    proxy.WriteParcelableVector(elementNames, data);
+    data.WriteString(localeInfo);
+
+    MockDistributedBmsHost host;
+    int res = host.OnRemoteRequest(static_cast<uint32_t>
+        (DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_PARTIAL), data, reply, option);
+    EXPECT_EQ(res, NO_ERROR);
+}
+
+/**
+ * @tc.number: OnRemoteRequest_2000
+ * @tc.name: Test OnRemoteRequest with GET_ABILITY_INFOS_PARTIAL
+ * @tc.desc: Verify the OnRemoteRequest return NO_ERROR.
+ */
+HWTEST_F(DistributedBmsHostTest, OnRemoteRequest_2000, Function | MediumTest | TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    data.WriteInterfaceToken(DistributedBmsHost::GetDescriptor());
+    std::vector<ElementName> elementNames;
+    std::string localeInfo;
+    DistributedBmsProxy proxy(nullptr);
+    proxy.WriteParcelableVector(elementNames, data);
+    data.WriteString(localeInfo);
+    DistributedBmsAclInfo aclInfo;
+    aclInfo.networkId = "networkId";
+    data.WriteBool(true);
+    data.WriteParcelable(&aclInfo);
+
+    MockDistributedBmsHost host;
+    int res = host.OnRemoteRequest(static_cast<uint32_t>
+        (DistributedInterfaceCode::GET_ABILITY_INFOS_PARTIAL), data, reply, option);
+    EXPECT_EQ(res, NO_ERROR);
+}
+
+/**
+ * @tc.number: OnRemoteRequest_2100
+ * @tc.name: Test OnRemoteRequest with GET_REMOTE_ABILITY_INFOS_CHUNKED
+ * @tc.desc: Verify the OnRemoteRequest accepts more elements than a single query.
+ */
+HWTEST_F(DistributedBmsHostTest, OnRemoteRequest_2100, Function | MediumTest | TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    data.WriteInterfaceToken(DistributedBmsHost::GetDescriptor());
+    std::vector<ElementName> elementNames(20, ElementName("deviceId", "bundleName", "abilityName"));
+    std::string localeInfo;
+    DistributedBmsProxy proxy(nullptr);
+    proxy.WriteParcelableVector(elementNames, data);
+    data.WriteString(localeInfo);
+    data.WriteUint64(0);
+
+    MockDistributedBmsHost host;
+    int res = host.OnRemoteRequest(static_cast<uint32_t>
+        (DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_CHUNKED), data, reply, option);
+    EXPECT_EQ(res, NO_ERROR);
+}
+
+/**
+ * @tc.number: OnRemoteRequest_2200
+ * @tc.name: Test OnRemoteRequest with GET_ABILITY_INFOS_PARTIAL and options
+ * @tc.desc: Verify the OnRemoteRequest return NO_ERROR.
+ */
+HWTEST_F(DistributedBmsHostTest, OnRemoteRequest_2200, Function | MediumTest | TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    data.WriteInterfaceToken(DistributedBmsHost::GetDescriptor());
+    std::vector<ElementName> elementNames;
+    std::string localeInfo;
+    DistributedBmsProxy proxy(nullptr);
+    proxy.WriteParcelableVector(elementNames, data);
+    data.WriteString(localeInfo);
+    data.WriteBool(false);
+    RemoteAbilityInfoOptions options;
+    options.fields = REMOTE_ABILITY_INFO_FIELD_LABEL;
+    data.WriteParcelable(&options);
+
+    MockDistributedBmsHost host;
+    int res = host.OnRemoteRequest(static_cast<uint32_t>
+        (DistributedInterfaceCode::GET_ABILITY_INFOS_PARTIAL), data, reply, option);
+    EXPECT_EQ(res, NO_ERROR);
+}
+
+/**
+ * @tc.number: OnRemoteRequest_2300
+ * @tc.name: Test OnRemoteRequest with GET_REMOTE_ABILITY_INFOS_PARTIAL and broken options
+ * @tc.desc: Verify the OnRemoteRequest return ERR_APPEXECFWK_PARCEL_ERROR.
+ */
+HWTEST_F(DistributedBmsHostTest, OnRemoteRequest_2300, Function | MediumTest | TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    data.WriteInterfaceToken(DistributedBmsHost::GetDescriptor());
+    std::vector<ElementName> elementNames;
+    std::string localeInfo;
+    DistributedBmsProxy proxy(nullptr);
+    proxy.WriteParcelableVector(elementNames, data);
+    data.WriteString(localeInfo);
+    data.WriteInt32(0);
+
+    MockDistributedBmsHost host;
+    int res = host.OnRemoteRequest(static_cast<uint32_t>
+        (DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_PARTIAL), data, reply, option);
+    EXPECT_EQ(res, ERR_APPEXECFWK_PARCEL_ERROR);
+}
+
+/**
+ * @tc.number: OnRemoteRequest_2400
+ * @tc.name: Test OnRemoteRequest with GET_REMOTE_ABILITY_INFOS_ASYNC and no callback
+ * @tc.desc: Verify the OnRemoteRequest return ERR_APPEXECFWK_PARCEL_ERROR.
+ */
+HWTEST_F(DistributedBmsHostTest, OnRemoteRequest_2400, Function | MediumTest | TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+
+    data.WriteInterfaceToken(DistributedBmsHost::GetDescriptor());
+    MockDistributedBmsHost host;
+    int res = host.OnRemoteRequest(static_cast<uint32_t>
+        (DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_ASYNC), data, reply, option);
+    EXPECT_EQ(res, ERR_APPEXECFWK_PARCEL_ERROR);
+}
+
+/**
+ * @tc.number: OnRemoteRequest_2500
+ * @tc.name: Test OnRemoteRequest with GET_REMOTE_ABILITY_INFOS_ASYNC and too many elements
+ * @tc.desc: Verify the failure is sent to the callback, as the caller does not read the reply.
+ */
+HWTEST_F(DistributedBmsHostTest, OnRemoteRequest_2500, Function | MediumTest | TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+
+    sptr<TestDistributedBmsCallback> callback = new (std::nothrow) TestDistributedBmsCallback();
+    ASSERT_NE(callback, nullptr);
+    data.WriteInterfaceToken(DistributedBmsHost::GetDescriptor());
+    data.WriteRemoteObject(callback->AsObject());
+    std::vector<ElementName> elementNames(11, ElementName("deviceId", "bundleName", "abilityName"));
+    DistributedBmsProxy proxy(nullptr);
+    proxy.WriteParcelableVector(elementNames, data);
+    data.WriteString("");
+
+    MockDistributedBmsHost host;
+    int res = host.OnRemoteRequest(static_cast<uint32_t>
+        (DistributedInterfaceCode::GET_REMOTE_ABILITY_INFOS_ASYNC), data, reply, option);
+    EXPECT_EQ(res, ERR_APPEXECFWK_PARCEL_ERROR);
+    EXPECT_EQ(callback->resultCount, 1);
+    EXPECT_EQ(callback->lastResultCode, ERR_APPEXECFWK_PARCEL_ERROR);
+}
+}
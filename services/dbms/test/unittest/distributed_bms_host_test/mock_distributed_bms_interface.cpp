@@ -67,6 +67,54 @@ int32_t MockDistributedBmsHost::GetAbilityInfos(const std::vector<ElementName> &
     return 0;
 }
 
+int32_t MockDistributedBmsHost::GetRemoteAbilityInfosWithBinaryIcon(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos)
+{
+    return 0;
+}
+
+int32_t MockDistributedBmsHost::GetAbilityInfosWithBinaryIcon(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos,
+    DistributedBmsAclInfo *info)
+{
+    return 0;
+}
+
+int32_t MockDistributedBmsHost::GetRemoteAbilityInfosIfModified(const std::vector<ElementName> &elementNames,
+    const std::vector<std::string> &iconHashes, const std::string &localeInfo,
+    std::vector<RemoteAbilityConditionalInfo> &remoteAbilityInfos)
+{
+    return 0;
+}
+
+int32_t MockDistributedBmsHost::GetAbilityInfosIfModified(const std::vector<ElementName> &elementNames,
+    const std::vector<std::string> &iconHashes, const std::string &localeInfo,
+    std::vector<RemoteAbilityConditionalInfo> &remoteAbilityInfos, DistributedBmsAclInfo *info)
+{
+    return 0;
+}
+
+int32_t MockDistributedBmsHost::GetRemoteAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+    std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+{
+    return 0;
+}
+
+int32_t MockDistributedBmsHost::GetAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+    std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos, DistributedBmsAclInfo *info)
+{
+    return 0;
+}
+
+int32_t MockDistributedBmsHost::GetRemoteAbilityInfosChunked(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const RemoteAbilityInfoOptions &options, uint64_t &continuationToken,
+    std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos)
+{
+    return 0;
+}
+
 bool MockDistributedBmsHost::GetDistributedBundleInfo(
     const std::string &networkId, const std::string &bundleName, DistributedBundleInfo &distributedBundleInfo)
 {
@@ -90,5 +138,23 @@ int32_t MockDistributedBmsHost::GetBundleVersionCode(const std::string &bundleNa
 {
     return 0;
 }
+
+int32_t MockDistributedBmsHost::GetRemoteAbilityInfosAsync(const std::vector<ElementName> &elementNames,
+    const std::string &localeInfo, const sptr<IRemoteObject> &callback)
+{
+    return 0;
+}
+
+int32_t MockDistributedBmsHost::GetRemoteBundleVersionCodeAsync(const std::string &deviceId,
+    const std::string &bundleName, const sptr<IRemoteObject> &callback)
+{
+    return 0;
+}
+
+int32_t MockDistributedBmsHost::GetDistributedBundleInfoAsync(const std::string &networkId,
+    const std::string &bundleName, const sptr<IRemoteObject> &callback)
+{
+    return 0;
+}
 } // namespace AppExecFwk
 } // namespace OHOS
\ No newline at end of file
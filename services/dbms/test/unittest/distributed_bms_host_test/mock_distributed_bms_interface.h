@@ -43,6 +43,28 @@ public:
         const std::vector<ElementName> &elementNames, std::vector<RemoteAbilityInfo> &remoteAbilityInfos) override;
     int32_t GetAbilityInfos(const std::vector<ElementName> &elementNames, const std::string &localeInfo,
         std::vector<RemoteAbilityInfo> &remoteAbilityInfos, DistributedBmsAclInfo *info = nullptr) override;
+    int32_t GetRemoteAbilityInfosWithBinaryIcon(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos) override;
+    int32_t GetAbilityInfosWithBinaryIcon(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, std::vector<RemoteAbilityBinaryInfo> &remoteAbilityInfos,
+        DistributedBmsAclInfo *info = nullptr) override;
+    int32_t GetRemoteAbilityInfosIfModified(const std::vector<ElementName> &elementNames,
+        const std::vector<std::string> &iconHashes, const std::string &localeInfo,
+        std::vector<RemoteAbilityConditionalInfo> &remoteAbilityInfos) override;
+    int32_t GetAbilityInfosIfModified(const std::vector<ElementName> &elementNames,
+        const std::vector<std::string> &iconHashes, const std::string &localeInfo,
+        std::vector<RemoteAbilityConditionalInfo> &remoteAbilityInfos,
+        DistributedBmsAclInfo *info = nullptr) override;
+    int32_t GetRemoteAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos) override;
+    int32_t GetAbilityInfosPartial(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const RemoteAbilityInfoOptions &options,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos,
+        DistributedBmsAclInfo *info = nullptr) override;
+    int32_t GetRemoteAbilityInfosChunked(const std::vector<ElementName> &elementNames,
+        const std::string &localeInfo, const RemoteAbilityInfoOptions &options, uint64_t &continuationToken,
+        std::vector<RemoteAbilityInfoResult> &remoteAbilityInfos) override;
     bool GetDistributedBundleInfo(const std::string &networkId, const std::string &bundleName,
         DistributedBundleInfo &distributedBundleInfo) override;
     int32_t GetDistributedBundleName(const std::string &networkId,  uint32_t accessTokenId,
@@ -51,6 +73,12 @@ public:
         uint32_t &versionCode) override;
     int32_t GetBundleVersionCode(const std::string &bundleName, uint32_t &versionCode,
         DistributedBmsAclInfo &info) override;
+    int32_t GetRemoteAbilityInfosAsync(const std::vector<ElementName> &elementNames, const std::string &localeInfo,
+        const sptr<IRemoteObject> &callback) override;
+    int32_t GetRemoteBundleVersionCodeAsync(const std::string &deviceId, const std::string &bundleName,
+        const sptr<IRemoteObject> &callback) override;
+    int32_t GetDistributedBundleInfoAsync(const std::string &networkId, const std::string &bundleName,
+        const sptr<IRemoteObject> &callback) override;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS